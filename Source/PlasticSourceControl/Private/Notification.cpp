@@ -20,11 +20,11 @@
 #define LOCTEXT_NAMESPACE "PlasticSourceControl"
 
 // Display an ongoing notification during the whole operation
-void FNotification::DisplayInProgress(const FText& InOperationInProgressString)
+void FNotification::DisplayInProgress(const TAttribute<FText>& InOperationInProgressString)
 {
 	if (!OperationInProgress.IsValid())
 	{
-		FNotificationInfo Info(InOperationInProgressString);
+		FNotificationInfo Info(InOperationInProgressString.Get());
 		Info.bFireAndForget = false;
 		Info.ExpireDuration = 0.0f;
 		Info.FadeOutDuration = 1.0f;
@@ -32,6 +32,10 @@ void FNotification::DisplayInProgress(const FText& InOperationInProgressString)
 		if (OperationInProgress.IsValid())
 		{
 			OperationInProgress.Pin()->SetCompletionState(SNotificationItem::CS_Pending);
+			if (InOperationInProgressString.IsBound())
+			{
+				OperationInProgress.Pin()->SetText(InOperationInProgressString);
+			}
 		}
 	}
 }
@@ -13,8 +13,9 @@ class FNotification
 {
 public:
 	// Create and display (resp. expire and remove) an in-progress notification for a long-running operation
+	// The text can be bound to an attribute reporting the progress of the operation
 	// Note: UI main thread only
-	void DisplayInProgress(const FText& InOperationInProgressString);
+	void DisplayInProgress(const TAttribute<FText>& InOperationInProgressString);
 	void RemoveInProgress();
 
 	bool IsInProgress() const
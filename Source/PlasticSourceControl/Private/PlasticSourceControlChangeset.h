@@ -14,8 +14,6 @@ public:
 	FDateTime Date;
 	FString Comment;
 	FString Branch;
-	// Note: array of file States, each with one Revision for Diffing (like for Files and ShelvedFiles in FPlasticSourceControlChangelist)
-	TArray<FPlasticSourceControlStateRef> Files;
 
 	void PopulateSearchString(TArray<FString>& OutStrings) const
 	{
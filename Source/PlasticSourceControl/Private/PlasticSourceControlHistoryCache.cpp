@@ -0,0 +1,306 @@
+// Copyright (c) 2024 Unity Technologies
+
+#include "PlasticSourceControlHistoryCache.h"
+
+#include "PlasticSourceControlBranch.h"
+#include "PlasticSourceControlChangeset.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "ISourceControlModule.h" // LogSourceControl
+
+namespace PlasticSourceControlHistoryCache
+{
+
+// Identify the kind of content of a cache file
+static const uint32 ChangesetsMagic = 0x50534343; // "PSCC"
+static const uint32 BranchesMagic = 0x50534342; // "PSCB"
+
+// Version of the format of the cache files, to bump on any change to their content so that the files of the previous versions get ignored
+static const int32 FormatVersion = 2;
+
+static FString GetCacheFilename(const TCHAR* InPrefix, const FString& InRepositorySpecification)
+{
+	// Note: the file also records the full repository specification, in case of a collision between hashes
+	const FString Filename = FString::Printf(TEXT("%s-%08X.bin"), InPrefix, FCrc::StrCrc32(*InRepositorySpecification));
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PlasticSourceControl") / Filename);
+}
+
+FString GetChangesetsFilename(const FString& InRepositorySpecification)
+{
+	return GetCacheFilename(TEXT("Changesets"), InRepositorySpecification);
+}
+
+FString GetBranchesFilename(const FString& InRepositorySpecification)
+{
+	return GetCacheFilename(TEXT("Branches"), InRepositorySpecification);
+}
+
+// Strings repeated across the records, like the owners and the branches, are written once in a table and then referenced by their index
+class FStringTable
+{
+public:
+	int32 Add(const FString& InString)
+	{
+		if (const int32* ExistingIndex = Indices.Find(InString))
+		{
+			return *ExistingIndex;
+		}
+		const int32 Index = Strings.Add(InString);
+		Indices.Add(InString, Index);
+		return Index;
+	}
+
+	TArray<FString> Strings;
+
+private:
+	TMap<FString, int32> Indices;
+};
+
+static void WriteHeader(FArchive& InAr, uint32 InMagic, const FString& InRepositorySpecification, const FDateTime& InFromDate)
+{
+	int32 Version = FormatVersion;
+	FString RepositorySpecification = InRepositorySpecification;
+	FDateTime FromDate = InFromDate;
+	InAr << InMagic;
+	InAr << Version;
+	InAr << RepositorySpecification;
+	InAr << FromDate;
+}
+
+static bool ReadHeader(FArchive& InAr, const uint32 InMagic, const FString& InRepositorySpecification, const FString& InFilename, FDateTime& OutFromDate)
+{
+	uint32 Magic = 0;
+	int32 Version = 0;
+	InAr << Magic;
+	InAr << Version;
+	if (InAr.IsError() || (Magic != InMagic))
+	{
+		UE_LOG(LogSourceControl, Warning, TEXT("Ignoring the invalid cache %s"), *InFilename);
+		return false;
+	}
+	if (Version != FormatVersion)
+	{
+		UE_LOG(LogSourceControl, Log, TEXT("Ignoring the cache %s of another version (%d instead of %d)"), *InFilename, Version, FormatVersion);
+		return false;
+	}
+
+	FString RepositorySpecification;
+	InAr << RepositorySpecification;
+	InAr << OutFromDate;
+	if (InAr.IsError() || (RepositorySpecification != InRepositorySpecification))
+	{
+		UE_LOG(LogSourceControl, Log, TEXT("Ignoring the cache %s of the repository '%s' instead of '%s'"), *InFilename, *RepositorySpecification, *InRepositorySpecification);
+		return false;
+	}
+
+	return true;
+}
+
+// Read a number of elements, checking it against the size of the file since each element takes at least one byte
+static bool ReadNum(FArchive& InAr, int32& OutNum)
+{
+	InAr << OutNum;
+	return !InAr.IsError() && (OutNum >= 0) && (OutNum <= InAr.TotalSize() - InAr.Tell());
+}
+
+static bool ReadStringTable(FArchive& InAr, TArray<FString>& OutStrings)
+{
+	int32 NumStrings = 0;
+	if (!ReadNum(InAr, NumStrings))
+		return false;
+
+	OutStrings.SetNum(NumStrings);
+	for (FString& String : OutStrings)
+	{
+		InAr << String;
+	}
+	return !InAr.IsError();
+}
+
+static bool ReadStringIndex(FArchive& InAr, const TArray<FString>& InStrings, FString& OutString)
+{
+	int32 Index = INDEX_NONE;
+	InAr << Index;
+	if (!InStrings.IsValidIndex(Index))
+		return false;
+
+	OutString = InStrings[Index];
+	return true;
+}
+
+// Write the content of the cache to a temporary file first, so that the previous one stays valid until the new one is complete
+static bool WriteCacheFile(const FString& InFilename, const TArray<uint8>& InData)
+{
+	const FString TempFilename = FPaths::CreateTempFilename(*FPaths::GetPath(InFilename), TEXT("Temp-"), TEXT(".bin"));
+	if (!FFileHelper::SaveArrayToFile(InData, *TempFilename))
+	{
+		UE_LOG(LogSourceControl, Warning, TEXT("Failed to write the cache %s"), *TempFilename);
+		return false;
+	}
+	if (!IFileManager::Get().Move(*InFilename, *TempFilename))
+	{
+		UE_LOG(LogSourceControl, Warning, TEXT("Failed to replace the cache %s"), *InFilename);
+		IFileManager::Get().Delete(*TempFilename);
+		return false;
+	}
+	return true;
+}
+
+bool SaveChangesets(const FString& InFilename, const FString& InRepositorySpecification, const FDateTime& InFromDate, const bool bInHasOlderChangesets, const TArray<FPlasticSourceControlChangesetRef>& InChangesets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlHistoryCache::SaveChangesets);
+
+	FStringTable StringTable;
+	for (const FPlasticSourceControlChangesetRef& Changeset : InChangesets)
+	{
+		StringTable.Add(Changeset->CreatedBy);
+		StringTable.Add(Changeset->Branch);
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Ar(Data);
+	WriteHeader(Ar, ChangesetsMagic, InRepositorySpecification, InFromDate);
+	bool bHasOlderChangesets = bInHasOlderChangesets;
+	Ar << bHasOlderChangesets;
+	Ar << StringTable.Strings;
+	int32 NumChangesets = InChangesets.Num();
+	Ar << NumChangesets;
+	for (const FPlasticSourceControlChangesetRef& Changeset : InChangesets)
+	{
+		int32 CreatedByIndex = StringTable.Add(Changeset->CreatedBy);
+		int32 BranchIndex = StringTable.Add(Changeset->Branch);
+		Ar << Changeset->ChangesetId;
+		Ar << CreatedByIndex;
+		Ar << Changeset->Date;
+		Ar << BranchIndex;
+		Ar << Changeset->Comment;
+	}
+
+	return WriteCacheFile(InFilename, Data);
+}
+
+bool LoadChangesets(const FString& InFilename, const FString& InRepositorySpecification, FDateTime& OutFromDate, bool& bOutHasOlderChangesets, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlHistoryCache::LoadChangesets);
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *InFilename, FILEREAD_Silent))
+		return false;
+
+	FMemoryReader Ar(Data);
+	// No string can be longer than the file: a corrupted length then fails the load instead of allocating that many characters
+	Ar.ArMaxSerializeSize = Data.Num();
+	if (!ReadHeader(Ar, ChangesetsMagic, InRepositorySpecification, InFilename, OutFromDate))
+		return false;
+
+	Ar << bOutHasOlderChangesets;
+
+	TArray<FString> Strings;
+	int32 NumChangesets = 0;
+	bool bLoaded = ReadStringTable(Ar, Strings) && ReadNum(Ar, NumChangesets);
+	if (bLoaded)
+	{
+		OutChangesets.Reserve(OutChangesets.Num() + NumChangesets);
+		for (int32 ChangesetIndex = 0; bLoaded && (ChangesetIndex < NumChangesets); ChangesetIndex++)
+		{
+			FPlasticSourceControlChangesetRef Changeset = MakeShared<FPlasticSourceControlChangeset, ESPMode::ThreadSafe>();
+			Ar << Changeset->ChangesetId;
+			bLoaded = ReadStringIndex(Ar, Strings, Changeset->CreatedBy);
+			Ar << Changeset->Date;
+			bLoaded = bLoaded && ReadStringIndex(Ar, Strings, Changeset->Branch);
+			Ar << Changeset->Comment;
+			bLoaded = bLoaded && !Ar.IsError();
+			OutChangesets.Add(MoveTemp(Changeset));
+		}
+	}
+	if (!bLoaded)
+	{
+		UE_LOG(LogSourceControl, Warning, TEXT("Failed to load the corrupted cache %s"), *InFilename);
+		OutChangesets.Reset();
+		return false;
+	}
+
+	UE_LOG(LogSourceControl, Verbose, TEXT("LoadChangesets: %d changesets from %s"), NumChangesets, *InFilename);
+	return true;
+}
+
+bool SaveBranches(const FString& InFilename, const FString& InRepositorySpecification, const FDateTime& InFromDate, const TArray<FPlasticSourceControlBranchRef>& InBranches)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlHistoryCache::SaveBranches);
+
+	FStringTable StringTable;
+	for (const FPlasticSourceControlBranchRef& Branch : InBranches)
+	{
+		StringTable.Add(Branch->Repository);
+		StringTable.Add(Branch->CreatedBy);
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Ar(Data);
+	WriteHeader(Ar, BranchesMagic, InRepositorySpecification, InFromDate);
+	Ar << StringTable.Strings;
+	int32 NumBranches = InBranches.Num();
+	Ar << NumBranches;
+	for (const FPlasticSourceControlBranchRef& Branch : InBranches)
+	{
+		int32 RepositoryIndex = StringTable.Add(Branch->Repository);
+		int32 CreatedByIndex = StringTable.Add(Branch->CreatedBy);
+		Ar << Branch->Name;
+		Ar << RepositoryIndex;
+		Ar << CreatedByIndex;
+		Ar << Branch->Date;
+		Ar << Branch->Comment;
+	}
+
+	return WriteCacheFile(InFilename, Data);
+}
+
+bool LoadBranches(const FString& InFilename, const FString& InRepositorySpecification, FDateTime& OutFromDate, TArray<FPlasticSourceControlBranchRef>& OutBranches)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlHistoryCache::LoadBranches);
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *InFilename, FILEREAD_Silent))
+		return false;
+
+	FMemoryReader Ar(Data);
+	Ar.ArMaxSerializeSize = Data.Num(); // See LoadChangesets()
+	if (!ReadHeader(Ar, BranchesMagic, InRepositorySpecification, InFilename, OutFromDate))
+		return false;
+
+	TArray<FString> Strings;
+	int32 NumBranches = 0;
+	bool bLoaded = ReadStringTable(Ar, Strings) && ReadNum(Ar, NumBranches);
+	if (bLoaded)
+	{
+		OutBranches.Reserve(OutBranches.Num() + NumBranches);
+		for (int32 BranchIndex = 0; bLoaded && (BranchIndex < NumBranches); BranchIndex++)
+		{
+			FPlasticSourceControlBranchRef Branch = MakeShared<FPlasticSourceControlBranch, ESPMode::ThreadSafe>();
+			Ar << Branch->Name;
+			bLoaded = ReadStringIndex(Ar, Strings, Branch->Repository);
+			bLoaded = bLoaded && ReadStringIndex(Ar, Strings, Branch->CreatedBy);
+			Ar << Branch->Date;
+			Ar << Branch->Comment;
+			bLoaded = bLoaded && !Ar.IsError();
+			OutBranches.Add(MoveTemp(Branch));
+		}
+	}
+	if (!bLoaded)
+	{
+		UE_LOG(LogSourceControl, Warning, TEXT("Failed to load the corrupted cache %s"), *InFilename);
+		OutBranches.Reset();
+		return false;
+	}
+
+	UE_LOG(LogSourceControl, Verbose, TEXT("LoadBranches: %d branches from %s"), NumBranches, *InFilename);
+	return true;
+}
+
+} // namespace PlasticSourceControlHistoryCache
@@ -0,0 +1,74 @@
+// Copyright (c) 2024 Unity Technologies
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+typedef TSharedRef<class FPlasticSourceControlBranch, ESPMode::ThreadSafe> FPlasticSourceControlBranchRef;
+typedef TSharedRef<class FPlasticSourceControlChangeset, ESPMode::ThreadSafe> FPlasticSourceControlChangesetRef;
+
+/**
+ * Persistent cache of the changesets and branches of a repository, saved under the Saved directory of the project
+ * so that the Changesets and Branches windows can display them instantly in the next editor sessions, while they are updated.
+ *
+ * Each file is in a versioned binary format, and records the repository it was fetched from:
+ * it is ignored if it doesn't match the repository of the workspace, or if it was saved with another version of the format.
+ */
+namespace PlasticSourceControlHistoryCache
+{
+
+/**
+ * Get the file caching the changesets of a repository
+ * @param	InRepositorySpecification	Repository specification, as returned by FPlasticSourceControlProvider::GetRepositorySpecification()
+ */
+FString GetChangesetsFilename(const FString& InRepositorySpecification);
+
+/**
+ * Get the file caching the branches of a repository
+ * @param	InRepositorySpecification	Repository specification, as returned by FPlasticSourceControlProvider::GetRepositorySpecification()
+ */
+FString GetBranchesFilename(const FString& InRepositorySpecification);
+
+/**
+ * Save the changesets of a repository, replacing the previous content of the file only once fully written
+ * @param	InFilename					File to save to, see GetChangesetsFilename()
+ * @param	InRepositorySpecification	Repository the changesets come from
+ * @param	InFromDate					Date from which the changesets were fetched, or the default date if they cover the whole history
+ * @param	bInHasOlderChangesets		Whether only the newest changesets since this date were fetched, by pages
+ * @param	InChangesets				Changesets to save
+ * @returns true if the file was written
+ */
+bool SaveChangesets(const FString& InFilename, const FString& InRepositorySpecification, const FDateTime& InFromDate, const bool bInHasOlderChangesets, const TArray<FPlasticSourceControlChangesetRef>& InChangesets);
+
+/**
+ * Load the changesets of a repository saved by SaveChangesets()
+ * @param	InFilename					File to load from, see GetChangesetsFilename()
+ * @param	InRepositorySpecification	Repository the changesets must come from
+ * @param	OutFromDate					Date from which the changesets were fetched
+ * @param	bOutHasOlderChangesets		Whether only the newest changesets since this date were fetched, by pages
+ * @param	OutChangesets				Changesets loaded, in the order they were saved
+ * @returns false if the file doesn't exist, is for another repository, was saved with another version of the format or is corrupted
+ */
+bool LoadChangesets(const FString& InFilename, const FString& InRepositorySpecification, FDateTime& OutFromDate, bool& bOutHasOlderChangesets, TArray<FPlasticSourceControlChangesetRef>& OutChangesets);
+
+/**
+ * Save the branches of a repository, replacing the previous content of the file only once fully written
+ * @param	InFilename					File to save to, see GetBranchesFilename()
+ * @param	InRepositorySpecification	Repository the branches come from
+ * @param	InFromDate					Date the branches were filtered from, or the default date for all the branches
+ * @param	InBranches					Branches to save
+ * @returns true if the file was written
+ */
+bool SaveBranches(const FString& InFilename, const FString& InRepositorySpecification, const FDateTime& InFromDate, const TArray<FPlasticSourceControlBranchRef>& InBranches);
+
+/**
+ * Load the branches of a repository saved by SaveBranches()
+ * @param	InFilename					File to load from, see GetBranchesFilename()
+ * @param	InRepositorySpecification	Repository the branches must come from
+ * @param	OutFromDate					Date the branches were filtered from
+ * @param	OutBranches					Branches loaded, in the order they were saved
+ * @returns false if the file doesn't exist, is for another repository, was saved with another version of the format or is corrupted
+ */
+bool LoadBranches(const FString& InFilename, const FString& InRepositorySpecification, FDateTime& OutFromDate, TArray<FPlasticSourceControlBranchRef>& OutBranches);
+
+} // namespace PlasticSourceControlHistoryCache
@@ -0,0 +1,306 @@
+// Copyright (c) 2024 Unity Technologies
+
+#include "PlasticSourceControlLock.h"
+
+#include "Misc/Paths.h"
+
+void FPlasticSourceControlLocksSummary::Add(const FPlasticSourceControlLock& InLock)
+{
+	Update(InLock, 1);
+}
+
+void FPlasticSourceControlLocksSummary::Remove(const FPlasticSourceControlLock& InLock)
+{
+	Update(InLock, -1);
+}
+
+void FPlasticSourceControlLocksSummary::ApplyChanges(const FPlasticSourceControlLocksChanges& InChanges)
+{
+	for (const FPlasticSourceControlLockRef& Lock : InChanges.Removed)
+	{
+		Remove(Lock.Get());
+	}
+	for (const FPlasticSourceControlLockRef& Lock : InChanges.Replaced)
+	{
+		Remove(Lock.Get());
+	}
+	for (const FPlasticSourceControlLockRef& Lock : InChanges.Added)
+	{
+		Add(Lock.Get());
+	}
+	for (const FPlasticSourceControlLockRef& Lock : InChanges.Changed)
+	{
+		Add(Lock.Get());
+	}
+}
+
+template<typename KeyType>
+static void UpdateLocksCount(TMap<KeyType, FPlasticSourceControlLocksSummary::FCount>& InOutCounts, const KeyType& InKey, const int32 InDelta, const int32 InRetainedDelta)
+{
+	FPlasticSourceControlLocksSummary::FCount& Count = InOutCounts.FindOrAdd(InKey);
+	Count.Num += InDelta;
+	Count.NumRetained += InRetainedDelta;
+	// Only keep the groups that still have locks, for the maps not to grow over time
+	if (Count.Num <= 0)
+	{
+		InOutCounts.Remove(InKey);
+	}
+}
+
+void FPlasticSourceControlLocksSummary::Update(const FPlasticSourceControlLock& InLock, const int32 InDelta)
+{
+	const int32 RetainedDelta = InLock.bIsLocked ? 0 : InDelta;
+
+	Total.Num += InDelta;
+	Total.NumRetained += RetainedDelta;
+	UpdateLocksCount(CountsByOwner, InLock.Owner, InDelta, RetainedDelta);
+	UpdateLocksCount(CountsByBranch, InLock.Branch, InDelta, RetainedDelta);
+	UpdateLocksCount(CountsByFolder, FPaths::GetPath(InLock.Path), InDelta, RetainedDelta);
+	UpdateLocksCount(CountsByHour, static_cast<int32>(InLock.Date.GetTicks() / ETimespan::TicksPerHour), InDelta, RetainedDelta);
+}
+
+TArray<FPlasticSourceControlLocksSummary::FCount> FPlasticSourceControlLocksSummary::GetCountsByAge(const FDateTime& InNow) const
+{
+	TArray<FCount> CountsByAge;
+	CountsByAge.SetNum(static_cast<int32>(EAge::Count));
+
+	const int32 NowHour = static_cast<int32>(InNow.GetTicks() / ETimespan::TicksPerHour);
+	for (const TPair<int32, FCount>& HourCount : CountsByHour)
+	{
+		const int32 AgeHours = NowHour - HourCount.Key;
+		EAge Age = EAge::MoreThanAMonth;
+		if (AgeHours < 24)
+		{
+			Age = EAge::LessThanADay;
+		}
+		else if (AgeHours < 7 * 24)
+		{
+			Age = EAge::LessThanAWeek;
+		}
+		else if (AgeHours < 30 * 24)
+		{
+			Age = EAge::LessThanAMonth;
+		}
+		FCount& Count = CountsByAge[static_cast<int32>(Age)];
+		Count.Num += HourCount.Value.Num;
+		Count.NumRetained += HourCount.Value.NumRetained;
+	}
+
+	return CountsByAge;
+}
+
+TArray<TPair<FString, FPlasticSourceControlLocksSummary::FCount>> FPlasticSourceControlLocksSummary::GetLargestCounts(const TMap<FString, FCount>& InCounts, const int32 InMaxNum)
+{
+	TArray<TPair<FString, FCount>> LargestCounts = InCounts.Array();
+	LargestCounts.Sort([](const TPair<FString, FCount>& Lhs, const TPair<FString, FCount>& Rhs)
+	{
+		return Lhs.Value.Num > Rhs.Value.Num;
+	});
+	if (LargestCounts.Num() > InMaxNum)
+	{
+		LargestCounts.SetNum(InMaxNum);
+	}
+	return LargestCounts;
+}
+
+// Serial numbers start at 1, 0 meaning "no previous index"
+static uint32 NextLocksIndexSerial()
+{
+	static volatile int32 LastSerial = 0;
+	return static_cast<uint32>(FPlatformAtomics::InterlockedIncrement(&LastSerial));
+}
+
+FPlasticSourceControlLocksIndex::FPlasticSourceControlLocksIndex()
+	: Serial(NextLocksIndexSerial())
+{
+}
+
+FPlasticSourceControlLocksIndex::FPlasticSourceControlLocksIndex(const TArray<FPlasticSourceControlLockRef>& InLocks)
+	: Locks(InLocks)
+	, Serial(NextLocksIndexSerial())
+{
+	BuildIndices();
+
+	for (const FPlasticSourceControlLockRef& Lock : Locks)
+	{
+		Summary.Add(Lock.Get());
+	}
+}
+
+FPlasticSourceControlLocksIndex::FPlasticSourceControlLocksIndex(const FPlasticSourceControlLocksIndex& InPreviousLocksIndex, TArray<FPlasticSourceControlLock>&& InLocks)
+	: Serial(NextLocksIndexSerial())
+	, PreviousSerial(InPreviousLocksIndex.Serial)
+{
+	const TArray<FPlasticSourceControlLockRef>& PreviousLocks = InPreviousLocksIndex.Locks;
+
+	// Previous locks matched by a new one; the others have been removed
+	TBitArray<> MatchedPreviousLocks(false, PreviousLocks.Num());
+
+	Locks.Reserve(InLocks.Num());
+	for (FPlasticSourceControlLock& Lock : InLocks)
+	{
+		// Find the first previous lock with the same id not matched yet
+		int32 PreviousLockIndex = INDEX_NONE;
+		if (const TArray<int32, TInlineAllocator<1>>* LockIndices = InPreviousLocksIndex.ItemIdToLockIndices.Find(Lock.ItemId))
+		{
+			for (const int32 LockIndex : *LockIndices)
+			{
+				if (!MatchedPreviousLocks[LockIndex] && PreviousLocks[LockIndex]->HasSameId(Lock))
+				{
+					PreviousLockIndex = LockIndex;
+					break;
+				}
+			}
+		}
+
+		if (PreviousLockIndex == INDEX_NONE)
+		{
+			FPlasticSourceControlLockRef AddedLock = MakeShareable(new FPlasticSourceControlLock(MoveTemp(Lock)));
+			Changes.Added.Add(AddedLock);
+			Locks.Add(MoveTemp(AddedLock));
+			continue;
+		}
+
+		MatchedPreviousLocks[PreviousLockIndex] = true;
+		const FPlasticSourceControlLockRef& PreviousLock = PreviousLocks[PreviousLockIndex];
+		if (*PreviousLock == Lock)
+		{
+			Locks.Add(PreviousLock);
+		}
+		else if (PreviousLock->Path != Lock.Path)
+		{
+			FPlasticSourceControlLockRef MovedLock = MakeShareable(new FPlasticSourceControlLock(MoveTemp(Lock)));
+			Changes.Removed.Add(PreviousLock);
+			Changes.Added.Add(MovedLock);
+			Locks.Add(MoveTemp(MovedLock));
+		}
+		else
+		{
+			FPlasticSourceControlLockRef ChangedLock = MakeShareable(new FPlasticSourceControlLock(MoveTemp(Lock)));
+			Changes.Replaced.Add(PreviousLock);
+			Changes.Changed.Add(ChangedLock);
+			Locks.Add(MoveTemp(ChangedLock));
+		}
+	}
+
+	for (int32 PreviousLockIndex = 0; PreviousLockIndex < PreviousLocks.Num(); PreviousLockIndex++)
+	{
+		if (!MatchedPreviousLocks[PreviousLockIndex])
+		{
+			Changes.Removed.Add(PreviousLocks[PreviousLockIndex]);
+		}
+	}
+
+	BuildIndices();
+
+	Summary = InPreviousLocksIndex.Summary;
+	Summary.ApplyChanges(Changes);
+}
+
+FPlasticSourceControlLocksIndex::FPlasticSourceControlLocksIndex(const FPlasticSourceControlLocksIndex& InPreviousLocksIndex, const TArray<FPlasticSourceControlLockRef>& InUnlockedLocks)
+	: Serial(NextLocksIndexSerial())
+	, PreviousSerial(InPreviousLocksIndex.Serial)
+{
+	const TArray<FPlasticSourceControlLockRef>& PreviousLocks = InPreviousLocksIndex.Locks;
+
+	TBitArray<> UnlockedPreviousLocks(false, PreviousLocks.Num());
+	for (const FPlasticSourceControlLockRef& UnlockedLock : InUnlockedLocks)
+	{
+		if (const TArray<int32, TInlineAllocator<1>>* LockIndices = InPreviousLocksIndex.ItemIdToLockIndices.Find(UnlockedLock->ItemId))
+		{
+			for (const int32 LockIndex : *LockIndices)
+			{
+				if (!UnlockedPreviousLocks[LockIndex] && PreviousLocks[LockIndex]->HasSameId(*UnlockedLock))
+				{
+					UnlockedPreviousLocks[LockIndex] = true;
+					Changes.Removed.Add(PreviousLocks[LockIndex]);
+					break;
+				}
+			}
+		}
+	}
+
+	Locks.Reserve(PreviousLocks.Num() - Changes.Removed.Num());
+	for (int32 PreviousLockIndex = 0; PreviousLockIndex < PreviousLocks.Num(); PreviousLockIndex++)
+	{
+		if (!UnlockedPreviousLocks[PreviousLockIndex])
+		{
+			Locks.Add(PreviousLocks[PreviousLockIndex]);
+		}
+	}
+
+	BuildIndices();
+
+	Summary = InPreviousLocksIndex.Summary;
+	Summary.ApplyChanges(Changes);
+}
+
+void FPlasticSourceControlLocksIndex::BuildIndices()
+{
+	PathToLockIndices.Reserve(Locks.Num());
+	ItemIdToLockIndices.Reserve(Locks.Num());
+	for (int32 LockIndex = 0; LockIndex < Locks.Num(); LockIndex++)
+	{
+		const FPlasticSourceControlLock& Lock = *Locks[LockIndex];
+		// Note: a lock without a path is the result of a line of the lock list that could not be parsed
+		if (!Lock.Path.IsEmpty())
+		{
+			PathToLockIndices.FindOrAdd(Lock.Path).Add(LockIndex);
+		}
+		ItemIdToLockIndices.FindOrAdd(Lock.ItemId).Add(LockIndex);
+	}
+}
+
+TArray<FPlasticSourceControlLockRef> FPlasticSourceControlLocksIndex::FindByPath(const FString& InPath) const
+{
+	TArray<FPlasticSourceControlLockRef> MatchingLocks;
+	if (const TArray<int32, TInlineAllocator<1>>* LockIndices = PathToLockIndices.Find(InPath))
+	{
+		MatchingLocks.Reserve(LockIndices->Num());
+		for (const int32 LockIndex : *LockIndices)
+		{
+			MatchingLocks.Add(Locks[LockIndex]);
+		}
+	}
+	return MatchingLocks;
+}
+
+TArray<FPlasticSourceControlLockRef> FPlasticSourceControlLocksIndex::FindByItemId(const int32 InItemId) const
+{
+	TArray<FPlasticSourceControlLockRef> MatchingLocks;
+	if (const TArray<int32, TInlineAllocator<1>>* LockIndices = ItemIdToLockIndices.Find(InItemId))
+	{
+		MatchingLocks.Reserve(LockIndices->Num());
+		for (const int32 LockIndex : *LockIndices)
+		{
+			MatchingLocks.Add(Locks[LockIndex]);
+		}
+	}
+	return MatchingLocks;
+}
+
+FPlasticSourceControlLockPtr FPlasticSourceControlLocksIndex::FindByFilename(const FString& InFilename) const
+{
+	// Server paths start with a slash, so only the suffixes of the filename starting with one can match:
+	// look up each of them, keeping the lock that comes first in the list
+	int32 FirstLockIndex = INDEX_NONE;
+	for (int32 CharIndex = InFilename.Len() - 1; CharIndex >= 0; CharIndex--)
+	{
+		if (InFilename[CharIndex] == TEXT('/'))
+		{
+			if (const TArray<int32, TInlineAllocator<1>>* LockIndices = PathToLockIndices.Find(InFilename.RightChop(CharIndex)))
+			{
+				if ((FirstLockIndex == INDEX_NONE) || ((*LockIndices)[0] < FirstLockIndex))
+				{
+					FirstLockIndex = (*LockIndices)[0];
+				}
+			}
+		}
+	}
+
+	if (FirstLockIndex != INDEX_NONE)
+	{
+		return Locks[FirstLockIndex];
+	}
+	return nullptr;
+}
@@ -26,7 +26,206 @@ public:
 		OutStrings.Emplace(Branch);
 		OutStrings.Emplace(Workspace);
 	}
+
+	/** A lock is identified by its item and its destination branch, since the same item can be locked for multiple destination branches */
+	bool HasSameId(const FPlasticSourceControlLock& InOther) const
+	{
+		return (ItemId == InOther.ItemId) && (DestinationBranch == InOther.DestinationBranch);
+	}
+
+	bool operator==(const FPlasticSourceControlLock& InOther) const
+	{
+		return HasSameId(InOther)
+			&& (Path == InOther.Path)
+			&& (Status == InOther.Status)
+			&& (bIsLocked == InOther.bIsLocked)
+			&& (Date == InOther.Date)
+			&& (Owner == InOther.Owner)
+			&& (Branch == InOther.Branch)
+			&& (Workspace == InOther.Workspace);
+	}
+
+	bool operator!=(const FPlasticSourceControlLock& InOther) const
+	{
+		return !(*this == InOther);
+	}
 };
 
 typedef TSharedRef<class FPlasticSourceControlLock, ESPMode::ThreadSafe> FPlasticSourceControlLockRef;
 typedef TSharedPtr<class FPlasticSourceControlLock, ESPMode::ThreadSafe> FPlasticSourceControlLockPtr;
+
+/**
+ * Differences between two successive lists of locks, each lock being identified by its item id and its destination branch.
+ *
+ * A lock that moved to another path is reported as removed and added, so that both paths get updated.
+ */
+class FPlasticSourceControlLocksChanges
+{
+public:
+	TArray<FPlasticSourceControlLockRef> Added;
+	TArray<FPlasticSourceControlLockRef> Removed;
+	/** New versions of the locks whose status, owner, date or branch changed */
+	TArray<FPlasticSourceControlLockRef> Changed;
+	/** Previous versions of the Changed locks, at the same indices */
+	TArray<FPlasticSourceControlLockRef> Replaced;
+
+	bool IsEmpty() const
+	{
+		return (Added.Num() == 0) && (Removed.Num() == 0) && (Changed.Num() == 0);
+	}
+};
+
+/**
+ * Aggregated counts of a list of locks by owner, by branch, by folder and by age,
+ * to spot the users holding many locks, the locks retained on old branches, and the locks held for days.
+ *
+ * Updated incrementally with the changes between two successive lists of locks, see FPlasticSourceControlLocksIndex::GetSummary()
+ */
+class FPlasticSourceControlLocksSummary
+{
+public:
+	/** Number of locks of a group, and how many of them are retained rather than locked */
+	struct FCount
+	{
+		int32 Num = 0;
+		int32 NumRetained = 0;
+	};
+
+	/** Age buckets of the locks, see GetCountsByAge() */
+	enum class EAge : uint8
+	{
+		LessThanADay,
+		LessThanAWeek,
+		LessThanAMonth,
+		MoreThanAMonth,
+		Count
+	};
+
+	void Add(const FPlasticSourceControlLock& InLock);
+	void Remove(const FPlasticSourceControlLock& InLock);
+	void ApplyChanges(const FPlasticSourceControlLocksChanges& InChanges);
+
+	const FCount& GetTotal() const
+	{
+		return Total;
+	}
+
+	const TMap<FString, FCount>& GetCountsByOwner() const
+	{
+		return CountsByOwner;
+	}
+
+	const TMap<FString, FCount>& GetCountsByBranch() const
+	{
+		return CountsByBranch;
+	}
+
+	/** Counts by parent folder of the server paths of the locks */
+	const TMap<FString, FCount>& GetCountsByFolder() const
+	{
+		return CountsByFolder;
+	}
+
+	/**
+	 * Counts by age bucket, derived at the time of the call from the counts by hour, so that the locks age without having to be counted again
+	 * @param	InNow	Current date, in the same time zone as the dates of the locks
+	 * @return	One count per age bucket, indexed by EAge
+	 */
+	TArray<FCount> GetCountsByAge(const FDateTime& InNow) const;
+
+	/** The groups with the most locks, in descending order */
+	static TArray<TPair<FString, FCount>> GetLargestCounts(const TMap<FString, FCount>& InCounts, const int32 InMaxNum);
+
+private:
+	void Update(const FPlasticSourceControlLock& InLock, const int32 InDelta);
+
+	FCount Total;
+	TMap<FString, FCount> CountsByOwner;
+	TMap<FString, FCount> CountsByBranch;
+	TMap<FString, FCount> CountsByFolder;
+	/** Counts by hours since the epoch of the lock dates, with few enough distinct hours to derive the age buckets on demand */
+	TMap<int32, FCount> CountsByHour;
+};
+
+/**
+ * Index of a list of locks by server path and by item id, built once when the list is loaded for constant time lookups.
+ *
+ * Multiple locks on the same item only happen if multiple destination branches are configured; they are kept in the order of the list.
+ */
+class FPlasticSourceControlLocksIndex
+{
+public:
+	FPlasticSourceControlLocksIndex();
+	explicit FPlasticSourceControlLocksIndex(const TArray<FPlasticSourceControlLockRef>& InLocks);
+
+	/**
+	 * Index a new list of locks, reusing the lock objects of the previous index that did not change,
+	 * so that the states and the rows of the View Locks window only need to be updated for the locks that actually changed.
+	 * @param	InPreviousLocksIndex	Index of the previous list of locks
+	 * @param	InLocks					New list of locks, as parsed from the lock list command
+	 */
+	FPlasticSourceControlLocksIndex(const FPlasticSourceControlLocksIndex& InPreviousLocksIndex, TArray<FPlasticSourceControlLock>&& InLocks);
+
+	/**
+	 * Index the locks of a previous index except the ones that have been released or removed, without listing them again.
+	 * @param	InPreviousLocksIndex	Index of the previous list of locks
+	 * @param	InUnlockedLocks			Locks to remove from the list, reported as removed, identified by their item id and destination branch
+	 */
+	FPlasticSourceControlLocksIndex(const FPlasticSourceControlLocksIndex& InPreviousLocksIndex, const TArray<FPlasticSourceControlLockRef>& InUnlockedLocks);
+
+	/** All the locks of the index, in the order of the list */
+	const TArray<FPlasticSourceControlLockRef>& GetLocks() const
+	{
+		return Locks;
+	}
+
+	/** Get the locks on the specified server path, eg "/Content/Maps/Map.umap" (case insensitive) */
+	TArray<FPlasticSourceControlLockRef> FindByPath(const FString& InPath) const;
+
+	/** Get the locks on the specified item */
+	TArray<FPlasticSourceControlLockRef> FindByItemId(const int32 InItemId) const;
+
+	/** Get the first lock of the list whose server path ends the specified absolute filename, eg "C:/Workspace/Project/Content/Maps/Map.umap" (case insensitive) */
+	FPlasticSourceControlLockPtr FindByFilename(const FString& InFilename) const;
+
+	/** Unique serial number of the index, to tell if a list of locks is the one an index was built from */
+	uint32 GetSerial() const
+	{
+		return Serial;
+	}
+
+	/** Serial number of the previous index the Changes are relative to, if any */
+	uint32 GetPreviousSerial() const
+	{
+		return PreviousSerial;
+	}
+
+	/** Differences with the previous index, if built from one */
+	const FPlasticSourceControlLocksChanges& GetChanges() const
+	{
+		return Changes;
+	}
+
+	/** Aggregated counts of the locks, updated from the summary of the previous index with the changes if built from one */
+	const FPlasticSourceControlLocksSummary& GetSummary() const
+	{
+		return Summary;
+	}
+
+private:
+	void BuildIndices();
+
+	TArray<FPlasticSourceControlLockRef> Locks;
+
+	/** Indices in Locks of the locks on each server path and on each item, in the order of the list */
+	TMap<FString, TArray<int32, TInlineAllocator<1>>> PathToLockIndices;
+	TMap<int32, TArray<int32, TInlineAllocator<1>>> ItemIdToLockIndices;
+
+	uint32 Serial;
+	uint32 PreviousSerial = 0;
+	FPlasticSourceControlLocksChanges Changes;
+	FPlasticSourceControlLocksSummary Summary;
+};
+
+typedef TSharedRef<const class FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe> FPlasticSourceControlLocksIndexRef;
+typedef TSharedPtr<const class FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe> FPlasticSourceControlLocksIndexPtr;
@@ -294,7 +294,7 @@ void FPlasticSourceControlMenu::ExecuteUnlock(TArray<FPlasticSourceControlLockRe
 		if (Result == ECommandResult::Succeeded)
 		{
 			// Display an ongoing notification during the whole operation (packages will be reloaded at the completion of the operation)
-			Notification.DisplayInProgress(UnlockOperation->GetInProgressString());
+			Notification.DisplayInProgress(TAttribute<FText>::CreateLambda([UnlockOperation]() { return UnlockOperation->GetInProgressString(); }));
 		}
 		else
 		{
@@ -3,6 +3,8 @@
 #include "PlasticSourceControlModule.h"
 
 #include "IPlasticSourceControlWorker.h"
+#include "PlasticSourceControlProjectSettings.h"
+#include "PlasticSourceControlRevision.h"
 
 #include "Interfaces/IPluginManager.h"
 #include "Features/IModularFeatures.h"
@@ -23,10 +25,26 @@ void FPlasticSourceControlModule::StartupModule()
 	PlasticSourceControlBranchesWindow.Register();
 	PlasticSourceControlChangesetsWindow.Register();
 	PlasticSourceControlLocksWindow.Register();
+
+	// The metadata of the changesets shared by the revisions embeds the display names of the users: build them again after a change to their settings
+	ProjectSettingsChangedHandle = GetMutableDefault<UPlasticSourceControlProjectSettings>()->OnSettingChanged().AddLambda([](UObject*, FPropertyChangedEvent& InPropertyChangedEvent)
+	{
+		const FName PropertyName = InPropertyChangedEvent.GetPropertyName();
+		if ((PropertyName == GET_MEMBER_NAME_CHECKED(UPlasticSourceControlProjectSettings, UserNameToDisplayName))
+			|| (PropertyName == GET_MEMBER_NAME_CHECKED(UPlasticSourceControlProjectSettings, bHideEmailDomainInUsername)))
+		{
+			FPlasticSourceControlChangesetMetadataTable::Get().Reset();
+		}
+	});
 }
 
 void FPlasticSourceControlModule::ShutdownModule()
 {
+	if (UObjectInitialized())
+	{
+		GetMutableDefault<UPlasticSourceControlProjectSettings>()->OnSettingChanged().Remove(ProjectSettingsChangedHandle);
+	}
+
 	// shut down the provider, as this module is going away
 	PlasticSourceControlProvider.Close();
 
@@ -86,4 +86,7 @@ private:
 
 	/** Logic to create a new workspace */
 	FPlasticSourceControlWorkspaceCreation PlasticSourceControlWorkspaceCreation;
+
+	/** Handle to the notification of changes to the Project Settings */
+	FDelegateHandle ProjectSettingsChangedHandle;
 };
@@ -31,6 +31,9 @@
 
 #define LOCTEXT_NAMESPACE "PlasticSourceControl"
 
+// Maximum number of locks released or removed by a single unlock command, to stay well below the limits of the command line
+static const int32 UnlockBatchSize = 100;
+
 template<typename Type>
 static FPlasticSourceControlWorkerRef InstantiateWorker(FPlasticSourceControlProvider& PlasticSourceControlProvider)
 {
@@ -60,6 +63,7 @@ void IPlasticSourceControlWorker::RegisterWorkers(FPlasticSourceControlProvider&
 	PlasticSourceControlProvider.RegisterWorker("DeleteBranches", FGetPlasticSourceControlWorker::CreateStatic(&InstantiateWorker<FPlasticDeleteBranchesWorker>));
 	PlasticSourceControlProvider.RegisterWorker("GetChangesets", FGetPlasticSourceControlWorker::CreateStatic(&InstantiateWorker<FPlasticGetChangesetsWorker>));
 	PlasticSourceControlProvider.RegisterWorker("GetChangesetFiles", FGetPlasticSourceControlWorker::CreateStatic(&InstantiateWorker<FPlasticGetChangesetFilesWorker>));
+	PlasticSourceControlProvider.RegisterWorker("GetHistory", FGetPlasticSourceControlWorker::CreateStatic(&InstantiateWorker<FPlasticGetHistoryWorker>));
 	PlasticSourceControlProvider.RegisterWorker("GetProjects", FGetPlasticSourceControlWorker::CreateStatic(&InstantiateWorker<FPlasticGetProjectsWorker>));
 	PlasticSourceControlProvider.RegisterWorker("MakeWorkspace", FGetPlasticSourceControlWorker::CreateStatic(&InstantiateWorker<FPlasticMakeWorkspaceWorker>));
 	PlasticSourceControlProvider.RegisterWorker("Sync", FGetPlasticSourceControlWorker::CreateStatic(&InstantiateWorker<FPlasticSyncWorker>));
@@ -177,6 +181,15 @@ FName FPlasticUnlock::GetName() const
 
 FText FPlasticUnlock::GetInProgressString() const
 {
+	const int32 NumProcessed = FPlatformAtomics::AtomicRead(&NumProcessedLocks);
+	if (NumProcessed > 0)
+	{
+		if (bRemove)
+			return FText::Format(LOCTEXT("SourceControl_Unlock_RemoveProgress", "Removing Lock(s)... ({0}/{1})"), FText::AsNumber(NumProcessed), FText::AsNumber(Locks.Num()));
+		else
+			return FText::Format(LOCTEXT("SourceControl_Unlock_ReleaseProgress", "Releasing Lock(s)... ({0}/{1})"), FText::AsNumber(NumProcessed), FText::AsNumber(Locks.Num()));
+	}
+
 	if (bRemove)
 		return LOCTEXT("SourceControl_Unlock_Remove", "Removing Lock(s)...");
 	else
@@ -251,6 +264,10 @@ FName FPlasticGetChangesets::GetName() const
 
 FText FPlasticGetChangesets::GetInProgressString() const
 {
+	if (ChangesetsLimit > 0)
+	{
+		return FText::Format(LOCTEXT("SourceControl_GetChangesetsLimit", "Getting up to {0} changesets..."), FText::AsNumber(ChangesetsLimit));
+	}
 	return LOCTEXT("SourceControl_GetChangesets", "Getting the list of changesets...");
 }
 
@@ -264,6 +281,20 @@ FText FPlasticGetChangesetFiles::GetInProgressString() const
 	return FText::Format(LOCTEXT("SourceControl_GetChangesetFiles", "Getting the list of files in changeset {0}..."), FText::AsNumber(Changeset->ChangesetId));
 }
 
+FName FPlasticGetHistory::GetName() const
+{
+	return "GetHistory";
+}
+
+FText FPlasticGetHistory::GetInProgressString() const
+{
+	if (HistoryLimit > 0)
+	{
+		return FText::Format(LOCTEXT("SourceControl_GetHistory", "Loading up to {0} revisions of the history..."), FText::AsNumber(HistoryLimit));
+	}
+	return LOCTEXT("SourceControl_GetFullHistory", "Loading the history...");
+}
+
 FName FPlasticGetProjects::GetName() const
 {
 	return "GetProjects";
@@ -1204,7 +1235,7 @@ bool FPlasticGetLocksWorker::Execute(FPlasticSourceControlCommand& InCommand)
 	{
 		// In the View Locks window, always show locks for all destination branches
 		const bool bForAllDestBranches = true;
-		InCommand.bCommandSuccessful = PlasticSourceControlUtils::RunListLocks(GetProvider(), bForAllDestBranches, Operation->Locks);
+		InCommand.bCommandSuccessful = PlasticSourceControlUtils::RunListLocks(GetProvider(), bForAllDestBranches, Operation->LocksIndex);
 	}
 
 	{
@@ -1234,39 +1265,54 @@ bool FPlasticUnlockWorker::Execute(FPlasticSourceControlCommand& InCommand)
 
 	InCommand.bCommandSuccessful = true;
 
-	TArray<FString> Branches;
-	for (const FPlasticSourceControlLockRef& Lock : Operation->Locks)
-	{
-		Branches.AddUnique(Lock->Branch);
-	}
-	for (const FString& Branch : Branches)
+	// One command per batch of locks on the same branches, carrying on with the next batches if one fails
+	const TArray<TArray<FPlasticSourceControlLockRef>> Batches = PlasticSourceControlUtils::BatchLocksToUnlock(Operation->Locks, UnlockBatchSize);
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); BatchIndex++)
 	{
+		const TArray<FPlasticSourceControlLockRef>& Batch = Batches[BatchIndex];
+
 		TArray<FString> Parameters;
 		Parameters.Add(TEXT("unlock"));
 		if (Operation->bRemove)
 			Parameters.Add(TEXT("--remove"));
 
-		Parameters.Add(FString::Printf(TEXT("--branch=%s"), *Branch));
-		for (const FPlasticSourceControlLockRef& Lock : Operation->Locks)
+		Parameters.Add(FString::Printf(TEXT("--branch=%s"), *Batch[0]->Branch));
+		for (const FPlasticSourceControlLockRef& Lock : Batch)
 		{
-			if (Lock->Branch == Branch)
-			{
-				Parameters.Add(FString::Printf(TEXT("itemid:%d "), Lock->ItemId));
-			}
+			Parameters.Add(FString::Printf(TEXT("itemid:%d "), Lock->ItemId));
+		}
+		const bool bBatchSuccessful = PlasticSourceControlUtils::RunCommand(TEXT("lock"), Parameters, TArray<FString>(), InCommand.InfoMessages, InCommand.ErrorMessages);
+		if (bBatchSuccessful)
+		{
+			Operation->UnlockedLocks.Append(Batch);
 		}
-		InCommand.bCommandSuccessful &= PlasticSourceControlUtils::RunCommand(TEXT("lock"), Parameters, TArray<FString>(), InCommand.InfoMessages, InCommand.ErrorMessages);
+		else
+		{
+			Operation->FailedLocks.Append(Batch);
+			InCommand.bCommandSuccessful = false;
+		}
+		FPlatformAtomics::InterlockedAdd(&Operation->NumProcessedLocks, Batch.Num());
+
+		UE_LOG(LogSourceControl, Verbose, TEXT("Unlock: batch %d/%d of %d lock(s) on branch %s: %s"), BatchIndex + 1, Batches.Num(), Batch.Num(), *Batch[0]->Branch, bBatchSuccessful ? TEXT("succeeded") : TEXT("failed"));
 	}
 
-	// now update the status of our files
-	PlasticSourceControlUtils::InvalidateLocksCache();
-	PlasticSourceControlUtils::RunUpdateStatus(InCommand.Files, PlasticSourceControlUtils::EStatusSearchType::ControlledOnly, false, InCommand.ErrorMessages, States, InCommand.ChangesetNumber);
+	if ((Operation->FailedLocks.Num() > 0) && (Operation->UnlockedLocks.Num() > 0))
+	{
+		// Partial failure: summarize it in the last error message, the one displayed by the notification
+		InCommand.ErrorMessages.Add(FString::Printf(TEXT("%d of %d lock(s) could not be %s"), Operation->FailedLocks.Num(), Operation->Locks.Num(), Operation->bRemove ? TEXT("removed") : TEXT("released")));
+	}
+
+	// Update the cached locks with the results instead of listing them all again; the states of the files are updated from them on the next tick
+	if (Operation->UnlockedLocks.Num() > 0)
+	{
+		PlasticSourceControlUtils::RemoveCachedLocks(Operation->UnlockedLocks, Operation->bRemove);
+	}
 
 	return InCommand.bCommandSuccessful;
 }
 
 bool FPlasticUnlockWorker::UpdateStates()
 {
-	PlasticSourceControlUtils::UpdateCachedStates(MoveTemp(States));
 	// Note: Force the return to always trigger a refresh of the List of Locks
 	// It's needed since when removing the Lock of a Checked Out asset there is actually no change in local status as the asset remains Checked Out!
 	return true;
@@ -1449,8 +1495,13 @@ bool FPlasticGetChangesetsWorker::Execute(FPlasticSourceControlCommand& InComman
 	check(InCommand.Operation->GetName() == GetName());
 	TSharedRef<FPlasticGetChangesets, ESPMode::ThreadSafe> Operation = StaticCastSharedRef<FPlasticGetChangesets>(InCommand.Operation);
 
+	if (Operation->BeforeChangesetId > 0)
+	{
+		InCommand.bCommandSuccessful = PlasticSourceControlUtils::RunGetOlderChangesets(Operation->FromDate, Operation->BeforeChangesetId, Operation->ChangesetsLimit, Operation->Changesets, Operation->bHasMoreChangesets, InCommand.ErrorMessages);
+	}
+	else
 	{
-		InCommand.bCommandSuccessful = PlasticSourceControlUtils::RunGetChangesets(Operation->FromDate, Operation->Changesets, InCommand.ErrorMessages);
+		InCommand.bCommandSuccessful = PlasticSourceControlUtils::RunGetChangesets(Operation->FromDate, Operation->ChangesetsLimit, Operation->Changesets, Operation->bHasMoreChangesets, InCommand.ErrorMessages);
 	}
 
 	{
@@ -1500,6 +1551,34 @@ bool FPlasticGetChangesetFilesWorker::UpdateStates()
 }
 
 
+FName FPlasticGetHistoryWorker::GetName() const
+{
+	return "GetHistory";
+}
+
+bool FPlasticGetHistoryWorker::Execute(FPlasticSourceControlCommand& InCommand)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPlasticGetHistoryWorker::Execute);
+
+	check(InCommand.Operation->GetName() == GetName());
+	TSharedRef<FPlasticGetHistory, ESPMode::ThreadSafe> Operation = StaticCastSharedRef<FPlasticGetHistory>(InCommand.Operation);
+
+	// The status of the files is required to interpret their history (current revision, merge in progress, repository of xlinks)
+	InCommand.bCommandSuccessful = PlasticSourceControlUtils::RunUpdateStatus(InCommand.Files, PlasticSourceControlUtils::EStatusSearchType::All, true, InCommand.ErrorMessages, States, InCommand.ChangesetNumber);
+	if (InCommand.bCommandSuccessful)
+	{
+		InCommand.bCommandSuccessful = PlasticSourceControlUtils::RunGetHistory(true, States, InCommand.ErrorMessages, Operation->HistoryLimit);
+	}
+
+	return InCommand.bCommandSuccessful;
+}
+
+bool FPlasticGetHistoryWorker::UpdateStates()
+{
+	return PlasticSourceControlUtils::UpdateCachedStates(MoveTemp(States));
+}
+
+
 FName FPlasticGetProjectsWorker::GetName() const
 {
 	return "GetProjects";
@@ -1957,6 +2036,8 @@ bool FPlasticGetPendingChangelistsWorker::UpdateStates()
 		if (bUpdateFilesStates)
 		{
 			ChangelistState->Files.Reset(OutCLFilesStates[StatusIndex].Num());
+			TSet<const FPlasticSourceControlState*> ChangelistFiles;
+			ChangelistFiles.Reserve(OutCLFilesStates[StatusIndex].Num());
 			for (const auto& FileState : OutCLFilesStates[StatusIndex])
 			{
 				TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe> CachedFileState = GetProvider().GetStateInternal(FileState.LocalFilename);
@@ -1966,7 +2047,12 @@ bool FPlasticGetPendingChangelistsWorker::UpdateStates()
 					CachedFileState->TimeStamp = Now;
 				}
 				CachedFileState->Changelist = CLStatus.Changelist;
-				ChangelistState->Files.AddUnique(CachedFileState);
+				bool bIsAlreadyInChangelist = false;
+				ChangelistFiles.Add(&CachedFileState.Get(), &bIsAlreadyInChangelist);
+				if (!bIsAlreadyInChangelist)
+				{
+					ChangelistState->Files.Add(CachedFileState);
+				}
 			}
 		}
 	}
@@ -23,6 +23,7 @@ typedef TSharedRef<class FPlasticSourceControlBranch, ESPMode::ThreadSafe> FPlas
 typedef TSharedRef<class FPlasticSourceControlChangeset, ESPMode::ThreadSafe> FPlasticSourceControlChangesetRef;
 typedef TSharedPtr<class FPlasticSourceControlChangeset, ESPMode::ThreadSafe> FPlasticSourceControlChangesetPtr;
 typedef TSharedRef<class FPlasticSourceControlLock, ESPMode::ThreadSafe> FPlasticSourceControlLockRef;
+typedef TSharedPtr<const class FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe> FPlasticSourceControlLocksIndexPtr;
 
 
 /**
@@ -135,8 +136,8 @@ public:
 
 	virtual FText GetInProgressString() const override;
 
-	// List of locks found
-	TArray<FPlasticSourceControlLockRef> Locks;
+	// List of locks found, indexed, with the changes since the previous list
+	FPlasticSourceControlLocksIndexPtr LocksIndex;
 };
 
 
@@ -156,6 +157,13 @@ public:
 
 	// Release the Lock(s), and optionally remove (delete) them completely
 	bool bRemove = false;
+
+	// Number of locks processed by the unlock commands run so far, updated after each batch for the progress notification
+	volatile int32 NumProcessedLocks = 0;
+
+	// Results of the operation: locks actually released or removed, and the ones that failed, in case of a partial failure
+	TArray<FPlasticSourceControlLockRef> UnlockedLocks;
+	TArray<FPlasticSourceControlLockRef> FailedLocks;
 };
 
 
@@ -280,8 +288,17 @@ public:
 	// Limit the list of changesets to ones created from this date (optional, filtering enabled by default)
 	FDateTime FromDate;
 
+	// Number of changesets to load, the newest ones, to load the list by pages (0 to load all of them)
+	int32 ChangesetsLimit = 0;
+
+	// Only load the changesets older than this one, to load the next page without the ones already loaded (optional, 0 for the newest ones)
+	int32 BeforeChangesetId = 0;
+
 	// List of changesets found
 	TArray<FPlasticSourceControlChangesetRef> Changesets;
+
+	// Whether older changesets remain to be loaded by raising the limit
+	bool bHasMoreChangesets = false;
 };
 
 
@@ -304,6 +321,22 @@ public:
 };
 
 
+/**
+ * Internal operation to load more of the history of files, using "cm history --limit=<NumRevisions>"
+*/
+class FPlasticGetHistory final : public FSourceControlOperationBase
+{
+public:
+	// ISourceControlOperation interface
+	virtual FName GetName() const override;
+
+	virtual FText GetInProgressString() const override;
+
+	// Number of revisions to load in the history of the files, INDEX_NONE for the full history (up to LimitNumberOfRevisionsInHistory)
+	int32 HistoryLimit = INDEX_NONE;
+};
+
+
 /**
  * Internal operation to list projects from a Unity organization
 */
@@ -571,10 +604,6 @@ public:
 	virtual FName GetName() const override;
 	virtual bool Execute(class FPlasticSourceControlCommand& InCommand) override;
 	virtual bool UpdateStates() override;
-
-public:
-	/** Temporary states for results */
-	TArray<FPlasticSourceControlState> States;
 };
 
 /** list branches. */
@@ -700,6 +729,24 @@ public:
 	virtual bool UpdateStates() override;
 };
 
+/** Load the next page of the history of files. */
+class FPlasticGetHistoryWorker final : public IPlasticSourceControlWorker
+{
+public:
+	explicit FPlasticGetHistoryWorker(FPlasticSourceControlProvider& InSourceControlProvider)
+		: IPlasticSourceControlWorker(InSourceControlProvider)
+	{}
+	virtual ~FPlasticGetHistoryWorker() = default;
+	// IPlasticSourceControlWorker interface
+	virtual FName GetName() const override;
+	virtual bool Execute(class FPlasticSourceControlCommand& InCommand) override;
+	virtual bool UpdateStates() override;
+
+public:
+	/** Temporary states for results */
+	TArray<FPlasticSourceControlState> States;
+};
+
 /** List Projects in Unity Organization. */
 class FPlasticGetProjectsWorker final : public IPlasticSourceControlWorker
 {
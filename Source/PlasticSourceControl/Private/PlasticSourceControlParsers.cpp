@@ -10,8 +10,10 @@
 #include "PlasticSourceControlState.h"
 #include "PlasticSourceControlUtils.h"
 #include "PlasticSourceControlVersions.h"
+#include "PlasticSourceControlXmlStreamReader.h"
 #include "ISourceControlModule.h"
 
+#include "Async/ParallelFor.h"
 #include "HAL/PlatformFile.h"
 #include "Misc/Paths.h"
 #include "XmlParser.h"
@@ -520,32 +522,14 @@ public:
 		}
 	}
 
-	int32 RevisionChangeset;
-	int32 RevisionHeadChangeset;
+	int32 RevisionChangeset = ISourceControlState::INVALID_REVISION;
+	int32 RevisionHeadChangeset = ISourceControlState::INVALID_REVISION;
 	FString RepSpec;
 	FString LockedBy;
 	FString LockedWhere;
 	FString ServerPath;
 };
 
-/**
- * Find the locks matching the file path from the list of locks
- *
- * Multiple matching locks can only happen if multiple destination branches are configured
-*/
-TArray<FPlasticSourceControlLockRef> FindMatchingLocks(const TArray<FPlasticSourceControlLockRef>& InLocks, const FString& InPath)
-{
-	TArray<FPlasticSourceControlLockRef> MatchingLocks;
-	for (int i = 0; i < InLocks.Num(); i++)
-	{
-		if (InLocks[i]->Path == InPath)
-		{
-			MatchingLocks.Add(InLocks[i]);
-		}
-	}
-	return MatchingLocks;
-}
-
 void ConcatStrings(FString& InOutString, const TCHAR* InSeparator, const FString& InOther)
 {
 	if (!InOutString.IsEmpty())
@@ -564,24 +548,39 @@ void ConcatStrings(FString& InOutString, const TCHAR* InSeparator, const FString
  */
 void ParseFileinfoResults(const TArray<FString>& InResults, TArray<FPlasticSourceControlState>& InOutStates)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseFileinfoResults);
-
-	ensureMsgf(InResults.Num() == InOutStates.Num(), TEXT("The fileinfo command should gives the same number of infos as the status command"));
-
 	const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
-	// Note: here is one of the rare places where we need to use a branch name, not a workspace selector
-	const FString& BranchName = Provider.GetBranchName();
 
-	TArray<FPlasticSourceControlLockRef> Locks;
+	FPlasticSourceControlLocksIndexPtr LocksIndex;
 	if (Provider.GetPlasticScmVersion() >= PlasticSourceControlVersions::SmartLocks)
 	{
 		// In the Content Browser, only show locks applying to the current working branch
 		const bool bForAllDestBranches = false;
-		PlasticSourceControlUtils::RunListLocks(Provider, bForAllDestBranches, Locks);
+		PlasticSourceControlUtils::RunListLocks(Provider, bForAllDestBranches, LocksIndex);
 	}
 
+	if (LocksIndex.IsValid())
+	{
+		ParseFileinfoResults(InResults, *LocksIndex, InOutStates);
+	}
+	else
+	{
+		ParseFileinfoResults(InResults, FPlasticSourceControlLocksIndex(), InOutStates);
+	}
+}
+
+void ParseFileinfoResults(const TArray<FString>& InResults, const FPlasticSourceControlLocksIndex& InLocksIndex, TArray<FPlasticSourceControlState>& InOutStates)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseFileinfoResults);
+
+	ensureMsgf(InResults.Num() == InOutStates.Num(), TEXT("The fileinfo command should gives the same number of infos as the status command"));
+
+	const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+	// Note: here is one of the rare places where we need to use a branch name, not a workspace selector
+	const FString& BranchName = Provider.GetBranchName();
+
 	// Iterate on all files and all status of the result (assuming same number of line of results than number of file states)
-	for (int32 IdxResult = 0; IdxResult < InResults.Num(); IdxResult++)
+	const int32 NumResults = FMath::Min(InResults.Num(), InOutStates.Num());
+	for (int32 IdxResult = 0; IdxResult < NumResults; IdxResult++)
 	{
 		const FString& Fileinfo = InResults[IdxResult];
 		FPlasticSourceControlState& FileState = InOutStates[IdxResult];
@@ -593,34 +592,7 @@ void ParseFileinfoResults(const TArray<FString>& InResults, TArray<FPlasticSourc
 		FileState.RepSpec = FileinfoParser.RepSpec;
 
 		// Additional information coming from Locks (branch, workspace, date and lock status)
-		// Note: in case of multi destination branches, we might have multiple locks for the same path, so we concatenate the string info
-		const TArray<FPlasticSourceControlLockRef> MatchingLocks = FindMatchingLocks(Locks, FileinfoParser.ServerPath);
-		for (auto& Lock : MatchingLocks)
-		{
-			// "Locked" vs "Retained" lock
-			if (Lock->bIsLocked)
-			{
-				ConcatStrings(FileState.LockedBy, TEXT(", "), PlasticSourceControlUtils::UserNameToDisplayName(Lock->Owner));
-			}
-			// Considers a "Retained" lock as meaningful only if it is retained on another branch
-			// NOTE: this is required to avoid the Unreal Editor showing a popup warning preventing the user to save the asset
-			else if (Lock->Branch != BranchName)
-			{
-				ConcatStrings(FileState.RetainedBy, TEXT(", "), PlasticSourceControlUtils::UserNameToDisplayName(Lock->Owner));
-			}
-			ConcatStrings(FileState.LockedWhere, TEXT(", "), Lock->Workspace);
-			ConcatStrings(FileState.LockedBranch, TEXT(", "), Lock->Branch);
-
-			// Only save the ItemId if there is only one matching Lock: used to Unlock it from the context menu in the Content Browser,
-			// but leave the ItmeId to invalid if there are more than one: there would be no way to know which one to unlock from the context menu
-			// (Unlocking in such a case require using the View Locks window instead for disambiguation)
-			if (MatchingLocks.Num() == 1)
-			{
-				FileState.LockedId = Lock->ItemId;
-			}
-			// Note; this will keep only the date of the last lock
-			FileState.LockedDate = Lock->Date;
-		}
+		UpdateStateLocks(InLocksIndex.FindByPath(FileinfoParser.ServerPath), BranchName, FileState);
 
 		// debug log (only for the first few files)
 		if (IdxResult < 20)
@@ -635,6 +607,44 @@ void ParseFileinfoResults(const TArray<FString>& InResults, TArray<FPlasticSourc
 	}
 }
 
+void UpdateStateLocks(const TArray<FPlasticSourceControlLockRef>& InMatchingLocks, const FString& InBranchName, FPlasticSourceControlState& InOutState)
+{
+	InOutState.LockedBy.Reset();
+	InOutState.RetainedBy.Reset();
+	InOutState.LockedWhere.Reset();
+	InOutState.LockedBranch.Reset();
+	InOutState.LockedId = ISourceControlState::INVALID_REVISION;
+	InOutState.LockedDate = 0;
+
+	// Note: in case of multi destination branches, we might have multiple locks for the same path, so we concatenate the string info
+	for (auto& Lock : InMatchingLocks)
+	{
+		// "Locked" vs "Retained" lock
+		if (Lock->bIsLocked)
+		{
+			ConcatStrings(InOutState.LockedBy, TEXT(", "), PlasticSourceControlUtils::UserNameToDisplayName(Lock->Owner));
+		}
+		// Considers a "Retained" lock as meaningful only if it is retained on another branch
+		// NOTE: this is required to avoid the Unreal Editor showing a popup warning preventing the user to save the asset
+		else if (Lock->Branch != InBranchName)
+		{
+			ConcatStrings(InOutState.RetainedBy, TEXT(", "), PlasticSourceControlUtils::UserNameToDisplayName(Lock->Owner));
+		}
+		ConcatStrings(InOutState.LockedWhere, TEXT(", "), Lock->Workspace);
+		ConcatStrings(InOutState.LockedBranch, TEXT(", "), Lock->Branch);
+
+		// Only save the ItemId if there is only one matching Lock: used to Unlock it from the context menu in the Content Browser,
+		// but leave the ItmeId to invalid if there are more than one: there would be no way to know which one to unlock from the context menu
+		// (Unlocking in such a case require using the View Locks window instead for disambiguation)
+		if (InMatchingLocks.Num() == 1)
+		{
+			InOutState.LockedId = Lock->ItemId;
+		}
+		// Note; this will keep only the date of the last lock
+		InOutState.LockedDate = Lock->Date;
+	}
+}
+
 // FILE_CONFLICT /Content/FirstPersonBP/Blueprints/FirstPersonProjectile.uasset 1 4 6 903
 // (explanations: 'The file /Content/FirstPersonBP/Blueprints/FirstPersonProjectile.uasset needs to be merged from cs:4 to cs:6 base cs:1. Changed by both contributors.')
 FPlasticMergeConflictParser::FPlasticMergeConflictParser(const FString& InResult)
@@ -644,15 +654,17 @@ FPlasticMergeConflictParser::FPlasticMergeConflictParser(const FString& InResult
 	{
 		FString Temp = InResult.RightChop(FILE_CONFLICT.Len());
 		int32 WhitespaceIndex;
-		if (Temp.FindChar(TEXT(' '), WhitespaceIndex))
+		if (!Temp.FindChar(TEXT(' '), WhitespaceIndex))
 		{
-			Filename = Temp.Left(WhitespaceIndex);
+			return;
 		}
+		Filename = Temp.Left(WhitespaceIndex);
 		Temp.RightChopInline(WhitespaceIndex + 1);
-		if (Temp.FindChar(TEXT(' '), WhitespaceIndex))
+		if (!Temp.FindChar(TEXT(' '), WhitespaceIndex))
 		{
-			BaseChangeset = Temp.Left(WhitespaceIndex);
+			return;
 		}
+		BaseChangeset = Temp.Left(WhitespaceIndex);
 		Temp.RightChopInline(WhitespaceIndex + 1);
 		if (Temp.FindChar(TEXT(' '), WhitespaceIndex))
 		{
@@ -661,6 +673,102 @@ FPlasticMergeConflictParser::FPlasticMergeConflictParser(const FString& InResult
 	}
 }
 
+// Parse a fixed number of decimal digits, returning -1 if any of them is not a digit
+static int32 ParseDigits(const TCHAR* InDigits, const int32 InNumDigits)
+{
+	int32 Value = 0;
+	for (int32 Index = 0; Index < InNumDigits; Index++)
+	{
+		const TCHAR Digit = InDigits[Index];
+		if ((Digit < TEXT('0')) || (Digit > TEXT('9')))
+		{
+			return -1;
+		}
+		Value = Value * 10 + (Digit - TEXT('0'));
+	}
+	return Value;
+}
+
+bool FPlasticDateParser::Parse(const FString& InDate, FDateTime& OutDate)
+{
+	const TCHAR* Date = *InDate;
+
+	// "YYYY-MM-DDTHH:MM:SS" followed by optional fractional seconds and timezone offset
+	if ((InDate.Len() < 19) || (Date[4] != TEXT('-')) || (Date[7] != TEXT('-')) || (Date[10] != TEXT('T')) || (Date[13] != TEXT(':')) || (Date[16] != TEXT(':')))
+	{
+		return FDateTime::ParseIso8601(Date, OutDate);
+	}
+
+	const int32 Minute = ParseDigits(Date + 14, 2);
+	const int32 Second = ParseDigits(Date + 17, 2);
+	if ((Minute < 0) || (Minute > 59) || (Second < 0) || (Second > 59))
+	{
+		return FDateTime::ParseIso8601(Date, OutDate);
+	}
+
+	// Fractional seconds, from 1 digit up to the 7 digits of the ticks emitted by cm (eg. ".1234567")
+	static const int32 MaxFractionDigits = 7;
+	const TCHAR* Next = Date + 19;
+	int32 FractionTicks = 0;
+	if (*Next == TEXT('.'))
+	{
+		Next++;
+		int32 NumDigits = 0;
+		for (; (NumDigits <= MaxFractionDigits) && (*Next >= TEXT('0')) && (*Next <= TEXT('9')); Next++, NumDigits++)
+		{
+			FractionTicks = FractionTicks * 10 + (*Next - TEXT('0'));
+		}
+		if ((NumDigits == 0) || (NumDigits > MaxFractionDigits))
+		{
+			return FDateTime::ParseIso8601(Date, OutDate);
+		}
+		for (; NumDigits < MaxFractionDigits; NumDigits++)
+		{
+			FractionTicks *= 10;
+		}
+	}
+
+	// Timezone offset, either "Z" or "+HH:MM" / "-HH:MM"; the date is converted to UTC
+	int32 TimezoneMinutes = 0;
+	if (*Next == TEXT('Z'))
+	{
+		Next++;
+	}
+	else if ((*Next == TEXT('+')) || (*Next == TEXT('-')))
+	{
+		const int32 TimezoneHour = ParseDigits(Next + 1, 2);
+		const int32 TimezoneMinute = (TimezoneHour >= 0) && (Next[3] == TEXT(':')) ? ParseDigits(Next + 4, 2) : -1;
+		if (TimezoneMinute < 0)
+		{
+			return FDateTime::ParseIso8601(Date, OutDate);
+		}
+		TimezoneMinutes = (*Next == TEXT('-')) ? -(TimezoneHour * 60 + TimezoneMinute) : (TimezoneHour * 60 + TimezoneMinute);
+		Next += 6;
+	}
+	if (*Next != TEXT('\0'))
+	{
+		return FDateTime::ParseIso8601(Date, OutDate);
+	}
+
+	// Date and hour are the costly part to convert, and are shared by most of the dates of a result
+	if ((CachedPrefixTicks < 0) || (FMemory::Memcmp(CachedPrefix, Date, sizeof(CachedPrefix)) != 0))
+	{
+		const int32 Year = ParseDigits(Date, 4);
+		const int32 Month = ParseDigits(Date + 5, 2);
+		const int32 Day = ParseDigits(Date + 8, 2);
+		const int32 Hour = ParseDigits(Date + 11, 2);
+		if ((Year < 1) || (Month < 1) || (Month > 12) || (Day < 1) || (Day > FDateTime::DaysInMonth(Year, Month)) || (Hour < 0) || (Hour > 23))
+		{
+			return FDateTime::ParseIso8601(Date, OutDate);
+		}
+		CachedPrefixTicks = FDateTime(Year, Month, Day, Hour).GetTicks();
+		FMemory::Memcpy(CachedPrefix, Date, sizeof(CachedPrefix));
+	}
+
+	OutDate = FDateTime(CachedPrefixTicks + (Minute - TimezoneMinutes) * ETimespan::TicksPerMinute + Second * ETimespan::TicksPerSecond + FractionTicks);
+	return true;
+}
+
 // Types of changes in source control revisions, using Perforce terminology for the History window
 static const TCHAR* SourceControlActionAdded = TEXT("add");
 static const TCHAR* SourceControlActionDeleted = TEXT("delete");
@@ -689,48 +797,98 @@ FString FileStateToAction(const EWorkspaceState InState)
 }
 
 // TODO PR to move this in Engine
-static FString DecodeXmlEntities(const FString& InString)
+/**
+ * Decode in place the XML entities of a string, in a single pass and without any allocation since the result is never longer.
+ * Fast path: the string is left untouched if it contains no '&'.
+ */
+static void DecodeXmlEntitiesInline(FString& InOutString)
 {
-	FString String = InString;
-	int32 AmpIdx;
-	if (String.FindChar(TEXT('&'), AmpIdx))
+	int32 ReadIndex;
+	if (!InOutString.FindChar(TEXT('&'), ReadIndex))
 	{
-		String.ReplaceInline(TEXT("&amp;"), TEXT("&"), ESearchCase::CaseSensitive);
-		String.ReplaceInline(TEXT("&quot;"), TEXT("\""), ESearchCase::CaseSensitive);
-		String.ReplaceInline(TEXT("&apos;"), TEXT("'"), ESearchCase::CaseSensitive);
-		String.ReplaceInline(TEXT("&lt;"), TEXT("<"), ESearchCase::CaseSensitive);
-		String.ReplaceInline(TEXT("&gt;"), TEXT(">"), ESearchCase::CaseSensitive);
+		return;
 	}
-	return String;
+
+	struct FXmlEntity
+	{
+		const TCHAR* Entity;
+		int32 Len;
+		TCHAR Char;
+	};
+	static const FXmlEntity XmlEntities[] = {
+		{ TEXT("&amp;"), 5, TEXT('&') },
+		{ TEXT("&quot;"), 6, TEXT('"') },
+		{ TEXT("&apos;"), 6, TEXT('\'') },
+		{ TEXT("&lt;"), 4, TEXT('<') },
+		{ TEXT("&gt;"), 4, TEXT('>') },
+	};
+
+	TCHAR* Chars = InOutString.GetCharArray().GetData();
+	const int32 Len = InOutString.Len();
+	int32 WriteIndex = ReadIndex;
+	while (ReadIndex < Len)
+	{
+		if (Chars[ReadIndex] == TEXT('&'))
+		{
+			const FXmlEntity* MatchingEntity = nullptr;
+			for (const FXmlEntity& XmlEntity : XmlEntities)
+			{
+				if ((ReadIndex + XmlEntity.Len <= Len) && (FCString::Strncmp(Chars + ReadIndex, XmlEntity.Entity, XmlEntity.Len) == 0))
+				{
+					MatchingEntity = &XmlEntity;
+					break;
+				}
+			}
+			if (MatchingEntity)
+			{
+				Chars[WriteIndex++] = MatchingEntity->Char;
+				ReadIndex += MatchingEntity->Len;
+				continue;
+			}
+		}
+		Chars[WriteIndex++] = Chars[ReadIndex++];
+	}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
+	InOutString.LeftInline(WriteIndex, EAllowShrinking::No);
+#else
+	InOutString.LeftInline(WriteIndex, false);
+#endif
+}
+
+static FString DecodeXmlEntities(FString&& InString)
+{
+	DecodeXmlEntitiesInline(InString);
+	return MoveTemp(InString);
+}
+
+static FString DecodeXmlEntities(const FString& InString)
+{
+	return DecodeXmlEntities(FString(InString));
 }
 
 /**
- * Parse one specific node of the result of the 'cm history --moveddeleted' command.
+ * Parse the Branch field of a Move entry in the result of the 'cm history --moveddeleted' command.
  *
  * Results of the history command in case of a move looks like that:
  <Branch>Moved from /Content/FirstPersonBP/Blueprints/BP_ToRename.uasset to /Content/FirstPersonBP/Blueprints/BP_TestsRenamed.uasset</Branch>
 */
-static FString ParseMovedFrom(const FXmlNode* InBranchNode)
+static FString ParseMovedFrom(const FString& InBranch)
 {
-	FString MovedFrom;
+	static const int32 MovedFromPrefixLen = FString("Moved from /").Len();
+	FString MovedFrom = InBranch.RightChop(MovedFromPrefixLen);
 
-	if (InBranchNode != nullptr)
+	const int32 MovedToIndex = MovedFrom.Find(TEXT(" to "), ESearchCase::CaseSensitive);
+	if (MovedToIndex != INDEX_NONE)
 	{
-		static const int32 MovedFromPrefixLen = FString("Moved from /").Len();
-		MovedFrom = InBranchNode->GetContent().RightChop(MovedFromPrefixLen);
-
-		const int32 MovedToIndex = MovedFrom.Find(TEXT(" to "), ESearchCase::CaseSensitive);
-		if (MovedToIndex != INDEX_NONE)
-		{
-			MovedFrom.LeftInline(MovedToIndex);
-		}
+		MovedFrom.LeftInline(MovedToIndex);
 	}
 
 	return MovedFrom; // Convert server path to absolute
 }
 
 /**
- * Parse results of the 'cm history --moveddeleted --xml --encoding="utf-8"' command.
+ * Streaming parser of the results of the 'cm history --moveddeleted --xml --encoding="utf-8"' command.
  *
  * Results of the history command looks like that:
 <RevisionHistoriesResult>
@@ -799,92 +957,208 @@ static FString ParseMovedFrom(const FXmlNode* InBranchNode)
   </RevisionHistories>
 </RevisionHistoriesResult>
 */
-static bool ParseHistoryResults(const bool bInUpdateHistory, const FXmlFile& InXmlResult, TArray<FPlasticSourceControlState>& InOutStates)
+class FHistoryResultsReader final : public FPlasticSourceControlXmlStreamReader
 {
-	const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
-	const FString& WorkspaceRoot = Provider.GetPathToWorkspaceRoot();
-	const FString RootRepSpec = FString::Printf(TEXT("%s@%s"), *Provider.GetRepositoryName(), *Provider.GetServerUrl());
-	const FString CurrentBranch = Provider.GetBranchName();
-
-	static const FString RevisionHistoriesResult(TEXT("RevisionHistoriesResult"));
-	static const FString RevisionHistories(TEXT("RevisionHistories"));
-	static const FString RevisionHistory(TEXT("RevisionHistory"));
-	static const FString ItemName(TEXT("ItemName"));
-	static const FString Revisions(TEXT("Revisions"));
-	static const FString Revision(TEXT("Revision"));
-	static const FString Branch(TEXT("Branch"));
-	static const FString CreationDate(TEXT("CreationDate"));
-	static const FString RevisionType(TEXT("RevisionType"));
-	static const FString ChangesetNumber(TEXT("ChangesetNumber"));
-	static const FString Owner(TEXT("Owner"));
-	static const FString Comment(TEXT("Comment"));
-	static const FString Size(TEXT("Size"));
-	static const FString Hash(TEXT("Hash"));
-
-	const FXmlNode* RevisionHistoriesResultNode = InXmlResult.GetRootNode();
-	if (RevisionHistoriesResultNode == nullptr || RevisionHistoriesResultNode->GetTag() != RevisionHistoriesResult)
-	{
-		return false;
-	}
+public:
+	FHistoryResultsReader(const bool bInUpdateHistory, const int32 InHistoryPageLimit, TArray<FPlasticSourceControlState>& InOutStates)
+		: FPlasticSourceControlXmlStreamReader(TEXT("RevisionHistoriesResult"))
+		, bUpdateHistory(bInUpdateHistory)
+		, HistoryPageLimit(InHistoryPageLimit)
+		, States(InOutStates)
+	{
+		const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+		WorkspaceRoot = Provider.GetPathToWorkspaceRoot();
+		RootRepSpec = FString::Printf(TEXT("%s@%s"), *Provider.GetRepositoryName(), *Provider.GetServerUrl());
+		CurrentBranch = Provider.GetBranchName();
+	}
+
+	/** Was the <RevisionHistories> element found */
+	bool bRevisionHistoriesFound = false;
+
+	/**
+	 * Update the states of the files with the revisions of their histories, once the whole XML has been read
+	 * @param	bInForceSingleThread	Parse all the histories on the calling thread
+	 */
+	void ParseRevisionHistories(const bool bInForceSingleThread);
+
+private:
+	/** The fields of a <Revision> of the history of a file, only the ones used */
+	struct FRevisionRecord
+	{
+		bool bHasRevisionType = false;
+		FString RevisionType;
+		bool bHasChangesetNumber = false;
+		FString ChangesetNumber;
+		FString Branch;
+		FString CreationDate;
+		FString Owner;
+		FString Comment;
+		FString Size;
+	};
+
+	/** The content of a <RevisionHistory> element: the history of one file */
+	struct FRevisionHistoryRecord
+	{
+		FString ItemName;
+		TArray<FRevisionRecord> Revisions;
+	};
+
+	virtual bool OnElementStart(const FString& InName, const int32 InDepth) override
+	{
+		static const FString RevisionHistories(TEXT("RevisionHistories"));
+		static const FString RevisionHistory(TEXT("RevisionHistory"));
+		static const FString Revisions(TEXT("Revisions"));
+		static const FString Revision(TEXT("Revision"));
+
+		if ((InDepth == 1) && (InName == RevisionHistories))
+		{
+			bRevisionHistoriesFound = true;
+		}
+		else if ((InDepth == 2) && (InName == RevisionHistory))
+		{
+			CurrentItemName.Reset();
+			bRevisionsFound = false;
+			RevisionRecords.Reset();
+		}
+		else if ((InDepth == 3) && (InName == Revisions))
+		{
+			bRevisionsFound = true;
+			bInRevisions = true;
+		}
+		else if ((InDepth == 4) && bInRevisions && (InName == Revision))
+		{
+			RevisionRecords.AddDefaulted();
+		}
 
-	const FXmlNode* RevisionHistoriesNode = RevisionHistoriesResultNode->FindChildNode(RevisionHistories);
-	if (RevisionHistoriesNode == nullptr)
-	{
-		return false;
+		return true;
 	}
 
-	const TArray<FXmlNode*>& RevisionHistoryNodes = RevisionHistoriesNode->GetChildrenNodes();
-	for (const FXmlNode* RevisionHistoryNode : RevisionHistoryNodes)
+	virtual bool OnElementEnd(const FString& InName, FString&& InContent, const int32 InDepth) override
 	{
-		const FXmlNode* ItemNameNode = RevisionHistoryNode->FindChildNode(ItemName);
-		if (ItemNameNode == nullptr)
+		static const FString RevisionHistory(TEXT("RevisionHistory"));
+		static const FString ItemName(TEXT("ItemName"));
+		static const FString Revisions(TEXT("Revisions"));
+		static const FString Branch(TEXT("Branch"));
+		static const FString CreationDate(TEXT("CreationDate"));
+		static const FString RevisionType(TEXT("RevisionType"));
+		static const FString ChangesetNumber(TEXT("ChangesetNumber"));
+		static const FString Owner(TEXT("Owner"));
+		static const FString Comment(TEXT("Comment"));
+		static const FString Size(TEXT("Size"));
+
+		if ((InDepth == 5) && bInRevisions && (RevisionRecords.Num() > 0))
 		{
-			continue;
+			FRevisionRecord& Record = RevisionRecords.Last();
+			if (InName == RevisionType)
+			{
+				Record.bHasRevisionType = true;
+				Record.RevisionType = MoveTemp(InContent);
+			}
+			else if (InName == ChangesetNumber)
+			{
+				Record.bHasChangesetNumber = true;
+				Record.ChangesetNumber = MoveTemp(InContent);
+			}
+			else if (InName == Branch)
+			{
+				Record.Branch = MoveTemp(InContent);
+			}
+			else if (InName == CreationDate)
+			{
+				Record.CreationDate = MoveTemp(InContent);
+			}
+			else if (InName == Owner)
+			{
+				Record.Owner = MoveTemp(InContent);
+			}
+			else if (InName == Comment)
+			{
+				Record.Comment = MoveTemp(InContent);
+			}
+			else if (InName == Size)
+			{
+				Record.Size = MoveTemp(InContent);
+			}
 		}
-
-		FString Filename = ItemNameNode->GetContent();
-		FPlasticSourceControlState* InOutStatePtr = InOutStates.FindByPredicate(
-			[&Filename](const FPlasticSourceControlState& State) { return State.LocalFilename == Filename; }
-		);
-		if (InOutStatePtr == nullptr)
+		else if (InDepth == 3)
 		{
-			continue;
+			if (InName == ItemName)
+			{
+				CurrentItemName = MoveTemp(InContent);
+			}
+			else if (InName == Revisions)
+			{
+				bInRevisions = false;
+			}
+		}
+		else if ((InDepth == 2) && (InName == RevisionHistory))
+		{
+			if (!CurrentItemName.IsEmpty() && bRevisionsFound)
+			{
+				RevisionHistoryRecords.Add(FRevisionHistoryRecord{ MoveTemp(CurrentItemName), MoveTemp(RevisionRecords) });
+			}
 		}
-		FPlasticSourceControlState& InOutState = *InOutStatePtr;
 
-		const FXmlNode* RevisionsNode = RevisionHistoryNode->FindChildNode(Revisions);
-		if (RevisionsNode == nullptr)
+		return true;
+	}
+
+	/** Changeset number of a revision, or INVALID_REVISION if not provided */
+	static int32 GetChangesetNumber(const FRevisionRecord& InRecord)
+	{
+		return InRecord.bHasChangesetNumber ? FCString::Atoi(*InRecord.ChangesetNumber) : ISourceControlState::INVALID_REVISION;
+	}
+
+	/** An empty <RevisionType> signals the additional entry of a Move, without its own revision */
+	static bool IsMoveEntry(const FRevisionRecord& InRecord)
+	{
+		return InRecord.bHasRevisionType && InRecord.RevisionType.IsEmpty();
+	}
+
+	static void BuildChangesetMetadata(const FRevisionRecord& InRecord, FPlasticDateParser& InOutDateParser, FPlasticSourceControlChangesetMetadata& OutMetadata)
+	{
+		OutMetadata.Description = DecodeXmlEntities(InRecord.Comment);
+		OutMetadata.UserName = PlasticSourceControlUtils::UserNameToDisplayName(InRecord.Owner);
+		if (!InRecord.CreationDate.IsEmpty())
 		{
-			continue;
+			InOutDateParser.Parse(InRecord.CreationDate, OutMetadata.Date);
 		}
+		OutMetadata.Branch = DecodeXmlEntities(InRecord.Branch);
+	}
+
+	/** Update the state of the file with the revisions of its history, sharing the metadata of their changesets resolved beforehand */
+	void ParseRevisionHistory(const FRevisionHistoryRecord& InRevisionHistory, const TMap<int32, FPlasticSourceControlChangesetMetadataPtr>& InChangesetsMetadata, FPlasticSourceControlState& InOutState) const
+	{
+		const TArray<FRevisionRecord>& Revisions = InRevisionHistory.Revisions;
+		FString Filename = InRevisionHistory.ItemName;
 
-		const TArray<FXmlNode*>& RevisionNodes = RevisionsNode->GetChildrenNodes();
-		if (bInUpdateHistory)
+		if (bUpdateHistory)
 		{
-			InOutState.History.Reserve(RevisionNodes.Num());
+			InOutState.History.Reserve(Revisions.Num());
+			// Keep track of the range of the history loaded, to load the next page on demand, unless the full history was requested or returned
+			InOutState.HistoryLimit = HistoryPageLimit;
+			InOutState.bHistoryComplete = (HistoryPageLimit <= 0) || (Revisions.Num() < HistoryPageLimit);
 		}
 
 		// parse history in reverse: needed to get most recent at the top (required by Unreal Editor for the "Diff with depot" using the index 0)
 		FString NextEntryMovedFrom;
-		for (int32 RevisionIndex = RevisionNodes.Num() - 1; RevisionIndex >= 0; RevisionIndex--)
+		for (int32 RevisionIndex = Revisions.Num() - 1; RevisionIndex >= 0; RevisionIndex--)
 		{
-			const FXmlNode* RevisionNode = RevisionNodes[RevisionIndex];
-			check(RevisionNode);
+			const FRevisionRecord& Record = Revisions[RevisionIndex];
 
 			const TSharedRef<FPlasticSourceControlRevision, ESPMode::ThreadSafe> SourceControlRevision = MakeShareable(new FPlasticSourceControlRevision);
 			SourceControlRevision->State = &InOutState;
 			SourceControlRevision->Filename = Filename;
 
-			if (const FXmlNode* RevisionTypeNode = RevisionNode->FindChildNode(RevisionType))
+			if (Record.bHasRevisionType)
 			{
 				// There are two entries for a Move of an asset;
 				// 1. a regular one with the normal data: revision, comment, branch, Id, size, hash etc.
 				// 2. and another "empty" one for the Move
 				// => Since the parsing is done in reverse order, the detection of a Move need to apply to the next entry
-				if (RevisionTypeNode->GetContent().IsEmpty())
+				if (Record.RevisionType.IsEmpty())
 				{
 					// An empty <RevisionType> signals a Move: save the "MovedFrom" filename to treat the next entry as a Move and update the Filename accordingly for next (older) entries
-					NextEntryMovedFrom = FPaths::Combine(WorkspaceRoot, ParseMovedFrom(RevisionNode->FindChildNode(Branch)));
+					NextEntryMovedFrom = FPaths::Combine(WorkspaceRoot, ParseMovedFrom(Record.Branch));
 
 					// and skip this revision as it is empty (it's just an additional entry with data for the move)
 					continue;
@@ -910,44 +1184,29 @@ static bool ParseHistoryResults(const bool bInUpdateHistory, const FXmlFile& InX
 				}
 			}
 
-			if (const FXmlNode* ChangesetNumberNode = RevisionNode->FindChildNode(ChangesetNumber))
+			if (Record.bHasChangesetNumber)
 			{
-				const FString& Changeset = ChangesetNumberNode->GetContent();
-				SourceControlRevision->ChangesetNumber = FCString::Atoi(*Changeset); // Value now used in the Revision column and in the Asset Menu History
+				const FString& Changeset = Record.ChangesetNumber;
+				SourceControlRevision->ChangesetNumber = GetChangesetNumber(Record); // Value now used in the Revision column and in the Asset Menu History
 
 				// Also append depot name to the revision, but only when it is different from the default one (ie for xlinks sub repository)
 				if (!InOutState.RepSpec.IsEmpty() && (InOutState.RepSpec != RootRepSpec))
 				{
-					TArray<FString> RepSpecs;
-					InOutState.RepSpec.ParseIntoArray(RepSpecs, TEXT("@"));
-					SourceControlRevision->Revision = FString::Printf(TEXT("cs:%s@%s"), *Changeset, *RepSpecs[0]);
+					int32 RepNameLen;
+					if (!InOutState.RepSpec.FindChar(TEXT('@'), RepNameLen))
+					{
+						RepNameLen = InOutState.RepSpec.Len();
+					}
+					SourceControlRevision->Revision = FString::Printf(TEXT("cs:%s@%s"), *Changeset, *InOutState.RepSpec.Left(RepNameLen));
 				}
 				else
 				{
 					SourceControlRevision->Revision = FString::Printf(TEXT("cs:%s"), *Changeset);
 				}
 			}
-			if (const FXmlNode* CommentNode = RevisionNode->FindChildNode(Comment))
-			{
-				SourceControlRevision->Description = DecodeXmlEntities(CommentNode->GetContent());
-			}
-			if (const FXmlNode* OwnerNode = RevisionNode->FindChildNode(Owner))
-			{
-				SourceControlRevision->UserName = PlasticSourceControlUtils::UserNameToDisplayName(OwnerNode->GetContent());
-			}
-			if (const FXmlNode* DateNode = RevisionNode->FindChildNode(CreationDate))
-			{
-				const FString& DateIso = DateNode->GetContent();
-				FDateTime::ParseIso8601(*DateIso, SourceControlRevision->Date);
-			}
-			if (const FXmlNode* BranchNode = RevisionNode->FindChildNode(Branch))
-			{
-				SourceControlRevision->Branch = DecodeXmlEntities(BranchNode->GetContent());
-			}
-			if (const FXmlNode* SizeNode = RevisionNode->FindChildNode(Size))
-			{
-				SourceControlRevision->FileSize = FCString::Atoi(*SizeNode->GetContent());
-			}
+			// Share the metadata of the changeset between all the revisions it modified, to parse and store them only once
+			SourceControlRevision->ChangesetMetadata = InChangesetsMetadata.FindChecked(SourceControlRevision->ChangesetNumber).ToSharedRef();
+			SourceControlRevision->FileSize = FCString::Atoi(*Record.Size);
 
 			// A negative RevisionHeadChangeset provided by fileinfo mean that the file has been unshelved;
 			// replace it by the changeset number of the first revision in the history (the more recent)
@@ -962,20 +1221,20 @@ static bool ParseHistoryResults(const bool bInUpdateHistory, const FXmlFile& InX
 			// since we usually don't want to display changes from other branches in the History window...
 			// except in case of a merge conflict, where the Editor expects the tip of the "source (remote)" branch to be at the top of the history!
 			if (   (SourceControlRevision->ChangesetNumber > InOutState.DepotRevisionChangeset)
-				&& (SourceControlRevision->Branch != CurrentBranch)
+				&& (SourceControlRevision->GetBranch() != CurrentBranch)
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 				&& (SourceControlRevision->GetRevision() != InOutState.PendingResolveInfo.RemoteRevision))
 #else
 				&& (SourceControlRevision->ChangesetNumber != InOutState.PendingMergeSourceChangeset))
 #endif
 			{
-				InOutState.HeadBranch = SourceControlRevision->Branch;
+				InOutState.HeadBranch = SourceControlRevision->GetBranch();
 				InOutState.HeadAction = SourceControlRevision->Action;
 				InOutState.HeadChangeList = SourceControlRevision->ChangesetNumber;
-				InOutState.HeadUserName = SourceControlRevision->UserName;
-				InOutState.HeadModTime = SourceControlRevision->Date.ToUnixTimestamp();
+				InOutState.HeadUserName = SourceControlRevision->GetUserName();
+				InOutState.HeadModTime = SourceControlRevision->GetDate().ToUnixTimestamp();
 			}
-			else if (bInUpdateHistory)
+			else if (bUpdateHistory)
 			{
 				InOutState.History.Add(SourceControlRevision);
 			}
@@ -983,36 +1242,167 @@ static bool ParseHistoryResults(const bool bInUpdateHistory, const FXmlFile& InX
 			// Also grab the UserName of the author of the current depot/head changeset
 			if ((SourceControlRevision->ChangesetNumber == InOutState.DepotRevisionChangeset) && InOutState.HeadUserName.IsEmpty())
 			{
-				InOutState.HeadUserName = SourceControlRevision->UserName;
+				InOutState.HeadUserName = SourceControlRevision->GetUserName();
 			}
 
-			if (!bInUpdateHistory)
+			if (!bUpdateHistory)
 			{
 				break; // if not updating the history, just getting the head of the latest branch is enough
 			}
 		}
 	}
 
-	return true;
-}
+	const bool bUpdateHistory;
+	const int32 HistoryPageLimit;
+	TArray<FPlasticSourceControlState>& States;
 
-bool ParseHistoryResults(const bool bInUpdateHistory, const FString& InXmlFilename, TArray<FPlasticSourceControlState>& InOutStates)
+	FString WorkspaceRoot;
+	FString RootRepSpec;
+	FString CurrentBranch;
+
+	/** Content of the <RevisionHistory> element being parsed */
+	FString CurrentItemName;
+	bool bRevisionsFound = false;
+	bool bInRevisions = false;
+	TArray<FRevisionRecord> RevisionRecords;
+
+	/** All the <RevisionHistory> elements read, to be parsed in parallel at the end */
+	TArray<FRevisionHistoryRecord> RevisionHistoryRecords;
+};
+
+void FHistoryResultsReader::ParseRevisionHistories(const bool bInForceSingleThread)
 {
-	bool bResult = false;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseRevisionHistories);
 
-	FXmlFile XmlFile;
+	// Index the states by filename once, to match each history to its state in constant time instead of a linear search
+	TMap<FString, int32> FilenameToStateIndex;
+	FilenameToStateIndex.Reserve(States.Num());
+	for (int32 StateIndex = 0; StateIndex < States.Num(); StateIndex++)
+	{
+		if (!FilenameToStateIndex.Contains(States[StateIndex].LocalFilename))
+		{
+			FilenameToStateIndex.Add(States[StateIndex].LocalFilename, StateIndex);
+		}
+	}
+
+	// Group the histories by state, in their order in the XML, so that each state is only ever updated by one task
+	TArray<int32> StateIndices;
+	TArray<TArray<int32, TInlineAllocator<1>>> HistoriesPerState;
+	TMap<int32, int32> StateIndexToGroup;
+	for (int32 HistoryIndex = 0; HistoryIndex < RevisionHistoryRecords.Num(); HistoryIndex++)
+	{
+		const int32* StateIndexPtr = FilenameToStateIndex.Find(RevisionHistoryRecords[HistoryIndex].ItemName);
+		if (StateIndexPtr == nullptr)
+		{
+			continue;
+		}
+		const int32 StateIndex = *StateIndexPtr;
+
+		if (const int32* Group = StateIndexToGroup.Find(StateIndex))
+		{
+			HistoriesPerState[*Group].Add(HistoryIndex);
+		}
+		else
+		{
+			StateIndexToGroup.Add(StateIndex, StateIndices.Num());
+			StateIndices.Add(StateIndex);
+			HistoriesPerState.AddDefaulted_GetRef().Add(HistoryIndex);
+		}
+	}
+
+	// Below a few histories, parsing in parallel is not worth the overhead of the tasks.
+	static const int32 MinHistoriesToParseInParallel = 16;
+	const bool bForceSingleThread = bInForceSingleThread || (StateIndices.Num() < MinHistoriesToParseInParallel);
+
+	// Resolve the metadata of the changesets of all the revisions up front, from the calling thread,
+	// so that the tasks parsing the revisions only read it instead of all locking the shared table for each of their revisions.
+	FPlasticSourceControlChangesetMetadataTable& MetadataTable = FPlasticSourceControlChangesetMetadataTable::Get();
+	TMap<FString, TMap<int32, FPlasticSourceControlChangesetMetadataPtr>> ChangesetsMetadataPerRepSpec;
+	struct FChangesetToBuild
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseHistoryResults::LoadXml);
-		bResult = XmlFile.LoadFile(InXmlFilename);
+		FString RepSpec;
+		int32 ChangesetNumber;
+		const FRevisionRecord* Record;
+	};
+	TArray<FChangesetToBuild> ChangesetsToBuild;
+	for (int32 GroupIndex = 0; GroupIndex < StateIndices.Num(); GroupIndex++)
+	{
+		const FPlasticSourceControlState& State = States[StateIndices[GroupIndex]];
+		const FString& RepSpec = State.RepSpec.IsEmpty() ? RootRepSpec : State.RepSpec;
+		TMap<int32, FPlasticSourceControlChangesetMetadataPtr>& ChangesetsMetadata = ChangesetsMetadataPerRepSpec.FindOrAdd(RepSpec);
+		for (const int32 HistoryIndex : HistoriesPerState[GroupIndex])
+		{
+			// In the same order as ParseRevisionHistory(), from the most recent revision
+			const TArray<FRevisionRecord>& Revisions = RevisionHistoryRecords[HistoryIndex].Revisions;
+			for (int32 RevisionIndex = Revisions.Num() - 1; RevisionIndex >= 0; RevisionIndex--)
+			{
+				const FRevisionRecord& Record = Revisions[RevisionIndex];
+				if (IsMoveEntry(Record))
+				{
+					continue;
+				}
+				const int32 ChangesetNumber = GetChangesetNumber(Record);
+				if (!ChangesetsMetadata.Contains(ChangesetNumber))
+				{
+					FPlasticSourceControlChangesetMetadataPtr Metadata = MetadataTable.Find(RepSpec, ChangesetNumber);
+					if (!Metadata.IsValid())
+					{
+						ChangesetsToBuild.Add(FChangesetToBuild{ RepSpec, ChangesetNumber, &Record });
+					}
+					ChangesetsMetadata.Add(ChangesetNumber, MoveTemp(Metadata));
+				}
+				if (!bUpdateHistory)
+				{
+					break; // only the head revision is parsed when not updating the history
+				}
+			}
+		}
 	}
+
+	// Decoding the comments is the expensive part: build the metadata of the new changesets in parallel, each task in its own slot
+	TArray<TSharedPtr<FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe>> BuiltMetadata;
+	BuiltMetadata.SetNum(ChangesetsToBuild.Num());
+	ParallelFor(ChangesetsToBuild.Num(), [&ChangesetsToBuild, &BuiltMetadata](const int32 BuildIndex)
+	{
+		FPlasticDateParser DateParser;
+		BuiltMetadata[BuildIndex] = MakeShared<FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe>();
+		BuildChangesetMetadata(*ChangesetsToBuild[BuildIndex].Record, DateParser, *BuiltMetadata[BuildIndex]);
+	}, bForceSingleThread || (ChangesetsToBuild.Num() < MinHistoriesToParseInParallel));
+	for (int32 BuildIndex = 0; BuildIndex < ChangesetsToBuild.Num(); BuildIndex++)
+	{
+		const FChangesetToBuild& ChangesetToBuild = ChangesetsToBuild[BuildIndex];
+		ChangesetsMetadataPerRepSpec[ChangesetToBuild.RepSpec][ChangesetToBuild.ChangesetNumber] = MetadataTable.Add(ChangesetToBuild.RepSpec, ChangesetToBuild.ChangesetNumber, BuiltMetadata[BuildIndex].ToSharedRef());
+	}
+	BuiltMetadata.Empty();
+
+	// Parsing the revisions of each file is independent from the others, so spread them across the task graph workers;
+	// the result is deterministic since each state is updated by a single task, with its histories in their original order.
+	ParallelFor(StateIndices.Num(), [this, &StateIndices, &HistoriesPerState, &ChangesetsMetadataPerRepSpec](const int32 GroupIndex)
+	{
+		FPlasticSourceControlState& State = States[StateIndices[GroupIndex]];
+		const TMap<int32, FPlasticSourceControlChangesetMetadataPtr>& ChangesetsMetadata = ChangesetsMetadataPerRepSpec.FindChecked(State.RepSpec.IsEmpty() ? RootRepSpec : State.RepSpec);
+		for (const int32 HistoryIndex : HistoriesPerState[GroupIndex])
+		{
+			ParseRevisionHistory(RevisionHistoryRecords[HistoryIndex], ChangesetsMetadata, State);
+		}
+	}, bForceSingleThread);
+
+	RevisionHistoryRecords.Empty();
+}
+
+bool ParseHistoryResults(const bool bInUpdateHistory, const int32 InHistoryPageLimit, FString&& InXmlResults, TArray<FPlasticSourceControlState>& InOutStates, const bool bInForceSingleThread /* = false */)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseHistoryResults);
+
+	FHistoryResultsReader Reader(bInUpdateHistory, InHistoryPageLimit, InOutStates);
+	const bool bResult = Reader.ParseBuffer(InXmlResults) && Reader.bRevisionHistoriesFound;
 	if (bResult)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseHistoryResults::ParseXml);
-		bResult = ParseHistoryResults(bInUpdateHistory, XmlFile, InOutStates);
+		Reader.ParseRevisionHistories(bInForceSingleThread);
 	}
 	else
 	{
-		UE_LOG(LogSourceControl, Error, TEXT("ParseHistoryResults: XML parse error '%s'"), *XmlFile.GetLastError())
+		UE_LOG(LogSourceControl, Error, TEXT("ParseHistoryResults: XML parse error '%s'"), *Reader.GetLastError())
 	}
 
 	return bResult;
@@ -1032,59 +1422,65 @@ bool ParseHistoryResults(const bool bInUpdateHistory, const FString& InXmlFilena
   </List>
 </UpdatedItems>
 */
-static bool ParseUpdateResults(const FXmlFile& InXmlResult, TArray<FString>& OutFiles)
+class FUpdateResultsReader final : public FPlasticSourceControlXmlStreamReader
 {
-	static const FString UpdatedItems(TEXT("UpdatedItems"));
-	static const FString List(TEXT("List"));
-	static const FString UpdatedItem(TEXT("UpdatedItem"));
-	static const FString Path(TEXT("Path"));
-
-	const FXmlNode* UpdatedItemsNode = InXmlResult.GetRootNode();
-	if (UpdatedItemsNode == nullptr || UpdatedItemsNode->GetTag() != UpdatedItems)
+public:
+	explicit FUpdateResultsReader(TArray<FString>& OutFiles)
+		: FPlasticSourceControlXmlStreamReader(TEXT("UpdatedItems"))
+		, Files(OutFiles)
+		, UniqueFiles(OutFiles)
 	{
-		return false;
 	}
 
-	const FXmlNode* ListNode = UpdatedItemsNode->FindChildNode(List);
-	if (ListNode == nullptr)
+	/** Was the <List> element found */
+	bool bListFound = false;
+
+private:
+	virtual bool OnElementStart(const FString& InName, const int32 InDepth) override
 	{
-		return false;
+		static const FString List(TEXT("List"));
+
+		if ((InDepth == 1) && (InName == List))
+		{
+			bListFound = true;
+		}
+
+		return true;
 	}
 
-	const TArray<FXmlNode*>& UpdatedItemNodes = ListNode->GetChildrenNodes();
-	for (const FXmlNode* UpdatedItemNode : UpdatedItemNodes)
+	virtual bool OnElementEnd(const FString& InName, FString&& InContent, const int32 InDepth) override
 	{
-		if (const FXmlNode* PathNode = UpdatedItemNode->FindChildNode(Path))
+		static const FString Path(TEXT("Path"));
+
+		if ((InDepth == 3) && (InName == Path))
 		{
-			FString Filename = PathNode->GetContent();
-			FPaths::NormalizeFilename(Filename);
-			if (!OutFiles.Contains(Filename))
+			FPaths::NormalizeFilename(InContent);
+			bool bIsAlreadyInSet = false;
+			UniqueFiles.Add(InContent, &bIsAlreadyInSet);
+			if (!bIsAlreadyInSet)
 			{
-				OutFiles.Add(Filename);
+				Files.Add(MoveTemp(InContent));
 			}
 		}
+
+		return true;
 	}
 
-	return true;
-}
+	TArray<FString>& Files;
 
-bool ParseUpdateResults(const FString& InResults, TArray<FString>& OutFiles)
+	/** Files already listed, to de-duplicate them in constant time on large updates */
+	TSet<FString> UniqueFiles;
+};
+
+bool ParseUpdateResults(FString&& InXmlResults, TArray<FString>& OutFiles)
 {
-	bool bResult = false;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseUpdateResults);
 
-	FXmlFile XmlFile;
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseUpdateResults::LoadXml);
-		bResult = XmlFile.LoadFile(InResults, EConstructMethod::ConstructFromBuffer);
-	}
-	if (bResult)
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseUpdateResults::ParseXml);
-		bResult = ParseUpdateResults(XmlFile, OutFiles);
-	}
-	else
+	FUpdateResultsReader Reader(OutFiles);
+	const bool bResult = Reader.ParseBuffer(InXmlResults) && Reader.bListFound;
+	if (!bResult)
 	{
-		UE_LOG(LogSourceControl, Error, TEXT("ParseUpdateResults: XML parse error '%s'"), *XmlFile.GetLastError())
+		UE_LOG(LogSourceControl, Error, TEXT("ParseUpdateResults: XML parse error '%s'"), *Reader.GetLastError())
 	}
 
 	return bResult;
@@ -1106,6 +1502,7 @@ bool ParseUpdateResults(const TArray<FString>& InResults, TArray<FString>& OutFi
 	static const FString Stage = TEXT("STAGE ");
 	static const int32 PrefixLen = 3; // "XX " typically "CH ", "AD " or "DE "
 
+	TSet<FString> UniqueFiles(OutFiles);
 	for (const FString& Result : InResults)
 	{
 		if (Result.StartsWith(Stage))
@@ -1113,9 +1510,11 @@ bool ParseUpdateResults(const TArray<FString>& InResults, TArray<FString>& OutFi
 
 		FString Filename = Result.RightChop(PrefixLen);
 		FPaths::NormalizeFilename(Filename);
-		if (!OutFiles.Contains(Filename))
+		bool bIsAlreadyInSet = false;
+		UniqueFiles.Add(Filename, &bIsAlreadyInSet);
+		if (!bIsAlreadyInSet)
 		{
-			OutFiles.Add(Filename);
+			OutFiles.Add(MoveTemp(Filename));
 		}
 	}
 
@@ -1187,96 +1586,193 @@ FText ParseCheckInResults(const TArray<FString>& InResults)
   </Changelists>
 </StatusOutput>
 */
-static bool ParseChangelistsResults(const FXmlFile& InXmlResult, TArray<FPlasticSourceControlChangelistState>& OutChangelistsStates, TArray<TArray<FPlasticSourceControlState>>& OutCLFilesStates)
+class FChangelistsResultsReader final : public FPlasticSourceControlXmlStreamReader
 {
-	static const FString StatusOutput(TEXT("StatusOutput"));
-	static const FString WkConfigType(TEXT("WkConfigType"));
-	static const FString WkConfigName(TEXT("WkConfigName"));
-	static const FString Changelists(TEXT("Changelists"));
-	static const FString Changelist(TEXT("Changelist"));
-	static const FString Name(TEXT("Name"));
-	static const FString Description(TEXT("Description"));
-	static const FString Changes(TEXT("Changes"));
-	static const FString Change(TEXT("Change"));
-	static const FString Type(TEXT("Type"));
-	static const FString Path(TEXT("Path"));
-	static const FString OldPath(TEXT("OldPath"));
+public:
+	FChangelistsResultsReader(TArray<FPlasticSourceControlChangelistState>& OutChangelistsStates, TArray<TArray<FPlasticSourceControlState>>& OutCLFilesStates)
+		: FPlasticSourceControlXmlStreamReader(TEXT("StatusOutput"))
+		, ChangelistsStates(OutChangelistsStates)
+		, CLFilesStates(OutCLFilesStates)
+	{
+		const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+		WorkspaceRoot = Provider.GetPathToWorkspaceRoot();
+		bUsesCheckedOutChanged = Provider.GetPlasticScmVersion() >= PlasticSourceControlVersions::StatusIsCheckedOutChanged;
+	}
 
-	FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
-	const FString& WorkspaceRoot = Provider.GetPathToWorkspaceRoot();
-	const bool bUsesCheckedOutChanged = Provider.GetPlasticScmVersion() >= PlasticSourceControlVersions::StatusIsCheckedOutChanged;
+private:
+	/** The fields of a <Change> of a changelist, only the ones used */
+	struct FChangeRecord
+	{
+		bool bHasPath = false;
+		FString Path;
+		bool bHasType = false;
+		FString Type;
+		FString OldPath;
+	};
 
-	const FXmlNode* StatusOutputNode = InXmlResult.GetRootNode();
-	if (StatusOutputNode == nullptr || StatusOutputNode->GetTag() != StatusOutput)
+	virtual bool OnElementStart(const FString& InName, const int32 InDepth) override
 	{
-		return false;
+		static const FString Changelists(TEXT("Changelists"));
+		static const FString Changes(TEXT("Changes"));
+
+		if ((InDepth == 1) && (InName == Changelists))
+		{
+			bInChangelists = true;
+		}
+		else if ((InDepth == 2) && bInChangelists)
+		{
+			Name.Reset();
+			Description.Reset();
+			bChangesFound = false;
+			ChangeRecords.Reset();
+		}
+		else if ((InDepth == 3) && bInChangelists && (InName == Changes))
+		{
+			bChangesFound = true;
+			bInChanges = true;
+		}
+		else if ((InDepth == 4) && bInChanges)
+		{
+			ChangeRecords.AddDefaulted();
+		}
+
+		return true;
 	}
 
-	const FXmlNode* ChangelistsNode = StatusOutputNode->FindChildNode(Changelists);
-	if (ChangelistsNode)
+	virtual bool OnElementEnd(const FString& InName, FString&& InContent, const int32 InDepth) override
 	{
-		const TArray<FXmlNode*>& ChangelistNodes = ChangelistsNode->GetChildrenNodes();
-		OutCLFilesStates.SetNum(ChangelistNodes.Num());
-		for (int32 ChangelistIndex = 0; ChangelistIndex < ChangelistNodes.Num(); ChangelistIndex++)
+		static const FString Changelists(TEXT("Changelists"));
+		static const FString NameTag(TEXT("Name"));
+		static const FString DescriptionTag(TEXT("Description"));
+		static const FString Changes(TEXT("Changes"));
+		static const FString Type(TEXT("Type"));
+		static const FString Path(TEXT("Path"));
+		static const FString OldPath(TEXT("OldPath"));
+
+		if ((InDepth == 5) && bInChanges && (ChangeRecords.Num() > 0))
 		{
-			const FXmlNode* ChangelistNode = ChangelistNodes[ChangelistIndex];
-			check(ChangelistNode);
-			const FXmlNode* NameNode = ChangelistNode->FindChildNode(Name);
-			const FXmlNode* DescriptionNode = ChangelistNode->FindChildNode(Description);
-			const FXmlNode* ChangesNode = ChangelistNode->FindChildNode(Changes);
-			if (NameNode == nullptr || DescriptionNode == nullptr || ChangesNode == nullptr)
+			FChangeRecord& Change = ChangeRecords.Last();
+			if (InName == Path)
 			{
-				continue;
+				Change.bHasPath = true;
+				Change.Path = MoveTemp(InContent);
+			}
+			else if (InName == Type)
+			{
+				Change.bHasType = true;
+				Change.Type = MoveTemp(InContent);
+			}
+			else if (InName == OldPath)
+			{
+				Change.OldPath = MoveTemp(InContent);
+			}
+		}
+		else if ((InDepth == 3) && bInChangelists)
+		{
+			if (InName == NameTag)
+			{
+				Name = MoveTemp(InContent);
 			}
+			else if (InName == DescriptionTag)
+			{
+				Description = MoveTemp(InContent);
+			}
+			else if (InName == Changes)
+			{
+				bInChanges = false;
+			}
+		}
+		else if ((InDepth == 2) && bInChangelists)
+		{
+			ParseChangelist();
+		}
+		else if ((InDepth == 1) && (InName == Changelists))
+		{
+			bInChangelists = false;
+		}
 
-			FString NameTemp = DecodeXmlEntities(NameNode->GetContent());
-			FPlasticSourceControlChangelist ChangelistTemp(MoveTemp(NameTemp), true);
-			FString DescriptionTemp = ChangelistTemp.IsDefault() ? FString() : DecodeXmlEntities(DescriptionNode->GetContent());
-			FPlasticSourceControlChangelistState ChangelistState(MoveTemp(ChangelistTemp), MoveTemp(DescriptionTemp));
+		return true;
+	}
 
-			const TArray<FXmlNode*>& ChangeNodes = ChangesNode->GetChildrenNodes();
-			for (const FXmlNode* ChangeNode : ChangeNodes)
-			{
-				check(ChangeNode);
-				const FXmlNode* PathNode = ChangeNode->FindChildNode(Path);
-				if (PathNode == nullptr)
-				{
-					continue;
-				}
+	/** Add the changelist and its files to the results, once its <Changelist> element is complete */
+	void ParseChangelist()
+	{
+		if (!Name.IsSet() || !Description.IsSet() || !bChangesFound)
+		{
+			return;
+		}
 
-				FPlasticSourceControlState FileState(FPaths::ConvertRelativePathToFull(WorkspaceRoot, PathNode->GetContent()));
-				FileState.Changelist = ChangelistState.Changelist;
-				if (const FXmlNode* TypeNode = ChangeNode->FindChildNode(Type))
-				{
-					FileState.WorkspaceState = StateFromStatus(TypeNode->GetContent(), bUsesCheckedOutChanged);
-				}
+		FString NameTemp = DecodeXmlEntities(MoveTemp(Name.GetValue()));
+		FPlasticSourceControlChangelist ChangelistTemp(MoveTemp(NameTemp), true);
+		FString DescriptionTemp = ChangelistTemp.IsDefault() ? FString() : DecodeXmlEntities(MoveTemp(Description.GetValue()));
+		FPlasticSourceControlChangelistState ChangelistState(MoveTemp(ChangelistTemp), MoveTemp(DescriptionTemp));
 
-				if (FileState.WorkspaceState == EWorkspaceState::Moved)
-				{
-					if (const FXmlNode* OldPathNode = ChangeNode->FindChildNode(OldPath))
-					{
-						FileState.MovedFrom = FPaths::ConvertRelativePathToFull(WorkspaceRoot, OldPathNode->GetContent());
-					}
-				}
+		TArray<FPlasticSourceControlState>& FilesStates = CLFilesStates.AddDefaulted_GetRef();
+		FilesStates.Reserve(ChangeRecords.Num());
+		TMap<FString, int32> FilenameToStateIndex;
+		FilenameToStateIndex.Reserve(ChangeRecords.Num());
+		for (const FChangeRecord& Change : ChangeRecords)
+		{
+			if (!Change.bHasPath)
+			{
+				continue;
+			}
 
-				// Note: in case of a Moved file, it appears twice in the list; just update the first entry (set as a "Changed") with the "Move" status
-				if (FPlasticSourceControlState* ExistingState = OutCLFilesStates[ChangelistIndex].FindByPredicate(
-					[&FileState](const FPlasticSourceControlState& InState)
-					{
-						return InState.GetFilename().Equals(FileState.GetFilename());
-					}))
-				{
-					ExistingState->WorkspaceState = FileState.WorkspaceState;
-					ExistingState->MovedFrom = FileState.MovedFrom;
-				}
-				else
-				{
-					OutCLFilesStates[ChangelistIndex].Add(MoveTemp(FileState));
-				}
+			FPlasticSourceControlState FileState(FPaths::ConvertRelativePathToFull(WorkspaceRoot, Change.Path));
+			FileState.Changelist = ChangelistState.Changelist;
+			if (Change.bHasType)
+			{
+				FileState.WorkspaceState = StateFromStatus(Change.Type, bUsesCheckedOutChanged);
+			}
+
+			if (FileState.WorkspaceState == EWorkspaceState::Moved)
+			{
+				FileState.MovedFrom = FPaths::ConvertRelativePathToFull(WorkspaceRoot, Change.OldPath);
 			}
 
-			OutChangelistsStates.Add(ChangelistState);
+			// Note: in case of a Moved file, it appears twice in the list; just update the first entry (set as a "Changed") with the "Move" status
+			if (const int32* ExistingStateIndex = FilenameToStateIndex.Find(FileState.GetFilename()))
+			{
+				FPlasticSourceControlState& ExistingState = FilesStates[*ExistingStateIndex];
+				ExistingState.WorkspaceState = FileState.WorkspaceState;
+				ExistingState.MovedFrom = MoveTemp(FileState.MovedFrom);
+			}
+			else
+			{
+				FilenameToStateIndex.Add(FileState.GetFilename(), FilesStates.Num());
+				FilesStates.Add(MoveTemp(FileState));
+			}
 		}
+
+		ChangelistsStates.Add(ChangelistState);
+	}
+
+	TArray<FPlasticSourceControlChangelistState>& ChangelistsStates;
+	TArray<TArray<FPlasticSourceControlState>>& CLFilesStates;
+
+	FString WorkspaceRoot;
+	bool bUsesCheckedOutChanged = false;
+
+	bool bInChangelists = false;
+	bool bInChanges = false;
+
+	/** Content of the <Changelist> element being parsed */
+	TOptional<FString> Name;
+	TOptional<FString> Description;
+	bool bChangesFound = false;
+	TArray<FChangeRecord> ChangeRecords;
+};
+
+bool ParseChangelistsResults(FString&& InXmlResults, TArray<FPlasticSourceControlChangelistState>& OutChangelistsStates, TArray<TArray<FPlasticSourceControlState>>& OutCLFilesStates)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseChangelistsResults);
+
+	FChangelistsResultsReader Reader(OutChangelistsStates, OutCLFilesStates);
+	const bool bResult = Reader.ParseBuffer(InXmlResults);
+	if (!bResult)
+	{
+		UE_LOG(LogSourceControl, Error, TEXT("ParseChangelistsResults: XML parse error '%s'"), *Reader.GetLastError())
+		return false;
 	}
 
 	if (!OutChangelistsStates.FindByPredicate(
@@ -1292,28 +1788,6 @@ static bool ParseChangelistsResults(const FXmlFile& InXmlResult, TArray<FPlastic
 	return true;
 }
 
-bool ParseChangelistsResults(const FString& InXmlFilename, TArray<FPlasticSourceControlChangelistState>& OutChangelistsStates, TArray<TArray<FPlasticSourceControlState>>& OutCLFilesStates)
-{
-	bool bResult = false;
-
-	FXmlFile XmlFile;
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseChangelistsResults::LoadXml);
-		bResult = XmlFile.LoadFile(InXmlFilename);
-	}
-	if (bResult)
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseChangelistsResults::ParseXml);
-		bResult = ParseChangelistsResults(XmlFile, OutChangelistsStates, OutCLFilesStates);
-	}
-	else
-	{
-		UE_LOG(LogSourceControl, Error, TEXT("ParseChangelistsResults: XML parse error '%s'"), *XmlFile.GetLastError())
-	}
-
-	return bResult;
-}
-
 // Parse the one letter file status in front of each line of the 'cm diff sh:<ShelveId>'
 EWorkspaceState ParseShelveFileStatus(const TCHAR InFileStatus)
 {
@@ -1357,6 +1831,13 @@ bool ParseShelveDiffResult(const FString InWorkspaceRoot, TArray<FString>&& InRe
 	InOutChangelistsState.ShelvedFiles.Reset(InResults.Num());
 	for (FString& Result : InResults)
 	{
+		// The shortest valid line is a status letter followed by a quoted filename, eg 'C "a"'
+		if (Result.Len() < 5)
+		{
+			bResult = false;
+			continue;
+		}
+
 		EWorkspaceState ShelveState = ParseShelveFileStatus(Result[0]);
 
 		// Remove outer double quotes
@@ -1638,6 +2119,72 @@ bool ParseShelvesResult(const FString& InResults, FString& OutComment, FDateTime
 #endif
 
 
+/** Is it an ISO 8601 date as in the --dateformat="yyyy-MM-ddTHH:mm:sszzz" of the 'cm find --format' commands, eg "2024-03-25T10:37:14+01:00" */
+static bool IsFindFormatDate(const FString& InField)
+{
+	return (InField.Len() >= 19) && FChar::IsDigit(InField[0]) && (InField[4] == TEXT('-')) && (InField[7] == TEXT('-')) && (InField[10] == TEXT('T'))
+		&& (InField[13] == TEXT(':')) && (InField[16] == TEXT(':'));
+}
+
+/**
+ * Split the results of a 'cm find --format' command into records of fields, each record starting with the separator.
+ *
+ * The last field being a free-form comment, it can contain the separator, and also continue on the following lines until the next record,
+ * including empty lines and lines starting with the separator: a line only starts a new record if it has all the fields,
+ * with the second one being the {date} in its fixed format.
+ * @return false if some lines outside of a comment were not a record with the expected number of fields
+ */
+static bool ParseFindFormatResults(const TArray<FString>& InResults, const int32 InNumFields, TFunctionRef<void(TArray<FString>& InOutFields)> InParseRecord)
+{
+	check(InNumFields >= 2);
+	static const int32 SeparatorLen = FCString::Strlen(FIND_FORMAT_SEPARATOR);
+
+	bool bResult = true;
+	bool bInRecord = false;
+	TArray<FString> Fields;
+	TArray<FString> LineFields;
+	for (const FString& Result : InResults)
+	{
+		bool bIsRecord = false;
+		if (Result.StartsWith(FIND_FORMAT_SEPARATOR, ESearchCase::CaseSensitive))
+		{
+			Result.RightChop(SeparatorLen).ParseIntoArray(LineFields, FIND_FORMAT_SEPARATOR, false); // Don't cull empty values
+			bIsRecord = (LineFields.Num() >= InNumFields) && IsFindFormatDate(LineFields[1]);
+		}
+
+		if (bIsRecord)
+		{
+			if (bInRecord)
+			{
+				InParseRecord(Fields);
+			}
+			Fields = MoveTemp(LineFields);
+			for (int32 IdxField = InNumFields; IdxField < Fields.Num(); IdxField++)
+			{
+				Fields[InNumFields - 1] += FIND_FORMAT_SEPARATOR + Fields[IdxField];
+			}
+			Fields.SetNum(InNumFields);
+			bInRecord = true;
+		}
+		else if (bInRecord)
+		{
+			// Next line of a multi-line comment
+			Fields[InNumFields - 1] += TEXT("\n") + Result;
+		}
+		else if (!Result.IsEmpty())
+		{
+			UE_LOG(LogSourceControl, Warning, TEXT("Malformed result '%s'"), *Result);
+			bResult = false;
+		}
+	}
+	if (bInRecord)
+	{
+		InParseRecord(Fields);
+	}
+	return bResult;
+}
+
+
 /**
  * Parse results of the 'cm find changeset --xml --encoding="utf-8"' command.
  *
@@ -1661,83 +2208,126 @@ bool ParseShelvesResult(const FString& InResults, FString& OutComment, FDateTime
   [...]
 </PLASTICQUERY>
 */
-static bool ParseChangesetesResults(const FXmlFile& InXmlResult, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+class FChangesetsResultsReader final : public FPlasticSourceControlXmlStreamReader
 {
-	static const FString PlasticQuery(TEXT("PLASTICQUERY"));
-	static const FString ChangesetId(TEXT("CHANGESETID"));
-	static const FString Branch(TEXT("BRANCH"));
-	static const FString Comment(TEXT("COMMENT"));
-	static const FString Owner(TEXT("OWNER"));
-	static const FString Date(TEXT("DATE"));
-
-	const FXmlNode* PlasticQueryNode = InXmlResult.GetRootNode();
-	if (PlasticQueryNode == nullptr || PlasticQueryNode->GetTag() != PlasticQuery)
+public:
+	explicit FChangesetsResultsReader(TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+		: FPlasticSourceControlXmlStreamReader(TEXT("PLASTICQUERY"))
+		, Changesets(OutChangesets)
 	{
-		return false;
 	}
 
-	const TArray<FXmlNode*>& ChangesetsNodes = PlasticQueryNode->GetChildrenNodes();
-	OutChangesets.Reserve(ChangesetsNodes.Num());
-	for (const FXmlNode* ChangesetNode : ChangesetsNodes)
+private:
+	virtual bool OnElementStart(const FString& InName, const int32 InDepth) override
 	{
-		check(ChangesetNode);
-		const FXmlNode* ChangesetIdNode = ChangesetNode->FindChildNode(ChangesetId);
-		if (ChangesetIdNode == nullptr)
+		if (InDepth == 1)
 		{
-			continue;
+			CurrentChangeset = MakeShareable(new FPlasticSourceControlChangeset());
+			bHasChangesetId = false;
 		}
 
-		FPlasticSourceControlChangesetRef ChangesetRef = MakeShareable(new FPlasticSourceControlChangeset());
+		return true;
+	}
 
-		ChangesetRef->ChangesetId = FCString::Atoi(*ChangesetIdNode->GetContent());
+	virtual bool OnElementEnd(const FString& InName, FString&& InContent, const int32 InDepth) override
+	{
+		static const FString ChangesetId(TEXT("CHANGESETID"));
+		static const FString Branch(TEXT("BRANCH"));
+		static const FString Comment(TEXT("COMMENT"));
+		static const FString Owner(TEXT("OWNER"));
+		static const FString Date(TEXT("DATE"));
 
-		if (const FXmlNode* CommentNode = ChangesetNode->FindChildNode(Comment))
-		{
-			ChangesetRef->Comment = DecodeXmlEntities(CommentNode->GetContent());
-		}
-		if (const FXmlNode* BranchNode = ChangesetNode->FindChildNode(Branch))
-		{
-			ChangesetRef->Branch = DecodeXmlEntities(BranchNode->GetContent());
-		}
-		if (const FXmlNode* OwnerNode = ChangesetNode->FindChildNode(Owner))
+		if ((InDepth == 2) && CurrentChangeset.IsValid())
 		{
-			// Note: keeping the full email address as the owner name so we can display both the short and full name in the tooltip
-			ChangesetRef->CreatedBy = OwnerNode->GetContent();
+			if (InName == ChangesetId)
+			{
+				CurrentChangeset->ChangesetId = FCString::Atoi(*InContent);
+				bHasChangesetId = true;
+			}
+			else if (InName == Comment)
+			{
+				CurrentChangeset->Comment = DecodeXmlEntities(MoveTemp(InContent));
+			}
+			else if (InName == Branch)
+			{
+				CurrentChangeset->Branch = DecodeXmlEntities(MoveTemp(InContent));
+			}
+			else if (InName == Owner)
+			{
+				// Note: keeping the full email address as the owner name so we can display both the short and full name in the tooltip
+				CurrentChangeset->CreatedBy = MoveTemp(InContent);
+			}
+			else if (InName == Date)
+			{
+				DateParser.Parse(InContent, CurrentChangeset->Date);
+			}
 		}
-		if (const FXmlNode* DateNode = ChangesetNode->FindChildNode(Date))
+		else if ((InDepth == 1) && CurrentChangeset.IsValid())
 		{
-			const FString& DateIso = DateNode->GetContent();
-			FDateTime::ParseIso8601(*DateIso, ChangesetRef->Date);
+			if (bHasChangesetId)
+			{
+				Changesets.Add(CurrentChangeset.ToSharedRef());
+			}
+			CurrentChangeset.Reset();
 		}
 
-		OutChangesets.Add(MoveTemp(ChangesetRef));
+		return true;
 	}
 
-	return true;
-}
+	TArray<FPlasticSourceControlChangesetRef>& Changesets;
+
+	/** Changeset being parsed */
+	FPlasticSourceControlChangesetPtr CurrentChangeset;
+	bool bHasChangesetId = false;
+
+	FPlasticDateParser DateParser;
+};
 
-bool ParseChangesetsResults(const FString& InXmlFilename, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+bool ParseChangesetsResults(FString&& InXmlResults, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
 {
-	bool bResult = false;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseChangesetsResults);
 
-	FXmlFile XmlFile;
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseChangesetesResults::LoadXml);
-		bResult = XmlFile.LoadFile(InXmlFilename);
-	}
-	if (bResult)
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseChangesetesResults::ParseXml);
-		bResult = ParseChangesetesResults(XmlFile, OutChangesets);
-	}
-	else
+	FChangesetsResultsReader Reader(OutChangesets);
+	const bool bResult = Reader.ParseBuffer(InXmlResults);
+	if (!bResult)
 	{
-		UE_LOG(LogSourceControl, Error, TEXT("ParseChangesetesResults: XML parse error '%s'"), *XmlFile.GetLastError())
+		UE_LOG(LogSourceControl, Error, TEXT("ParseChangesetsResults: XML parse error '%s'"), *Reader.GetLastError())
 	}
 
 	return bResult;
 }
 
+/**
+ * Parse results of the 'cm find changesets --format="#_#{changesetid}#_#{date}#_#{owner}#_#{branch}#_#{comment}" --nototal' command.
+ *
+ * Results of the find command looks like the following, the second changeset having a multi-line comment:
+#_#56#_#2024-03-25T10:37:14+01:00#_#sebastien.rombauts@unity3d.com#_#/main#_#test
+#_#55#_#2024-03-25T10:21:40+01:00#_#sebastien.rombauts@unity3d.com#_#/main#_#Fix the lighting
+Rebuild the lighting of the main level
+*/
+bool ParseChangesetsResults(const TArray<FString>& InResults, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseChangesetsResultsFormat);
+
+	FPlasticDateParser DateParser;
+	OutChangesets.Reserve(InResults.Num());
+	return ParseFindFormatResults(InResults, 5, [&OutChangesets, &DateParser](TArray<FString>& InOutFields)
+	{
+		if (InOutFields[0].IsEmpty())
+		{
+			return;
+		}
+		FPlasticSourceControlChangesetRef Changeset = MakeShareable(new FPlasticSourceControlChangeset());
+		Changeset->ChangesetId = FCString::Atoi(*InOutFields[0]);
+		DateParser.Parse(InOutFields[1], Changeset->Date);
+		// Note: keeping the full email address as the owner name so we can display both the short and full name in the tooltip
+		Changeset->CreatedBy = MoveTemp(InOutFields[2]);
+		Changeset->Branch = MoveTemp(InOutFields[3]);
+		Changeset->Comment = MoveTemp(InOutFields[4]);
+		OutChangesets.Add(MoveTemp(Changeset));
+	});
+}
+
 
 /**
  * Convert the type of change in the log of changesets to a state.
@@ -1769,6 +2359,16 @@ static EWorkspaceState StateFromType(const FString& InChangeType)
 	return EWorkspaceState::Unknown;
 }
 
+/** The fields of an <Item> of the <Changes> of a changeset, only the ones used */
+struct FChangeRecord
+{
+	bool bHasDstCmPath = false;
+	FString DstCmPath;
+	bool bHasType = false;
+	FString Type;
+	FString SrcCmPath;
+};
+
 /**
  * Parse Changes child node in a Changeset.
  *
@@ -1797,73 +2397,64 @@ static EWorkspaceState StateFromType(const FString& InChangeType)
   </Changeset>
 </LogList>
  */
-static void ParseChangesInChangeset(const FXmlNode* InChangesetNode, const FPlasticSourceControlChangesetRef& InChangeset, TArray<FPlasticSourceControlStateRef>& OutFiles)
+static void ParseChangesInChangeset(const TArray<FChangeRecord>& InChanges, const FPlasticSourceControlChangesetRef& InChangeset, TArray<FPlasticSourceControlStateRef>& OutFiles)
 {
-	static const FString Changes(TEXT("Changes"));
-	static const FString Item(TEXT("Item"));
-	static const FString Type(TEXT("Type"));
-	static const FString SrcCmPath(TEXT("SrcCmPath"));
-	static const FString DstCmPath(TEXT("DstCmPath"));
-
 	const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
 	const FString RootRepSpec = FString::Printf(TEXT("%s@%s"), *Provider.GetRepositoryName(), *Provider.GetServerUrl());
 
-	if (const FXmlNode* ChangesNode = InChangesetNode->FindChildNode(Changes))
+	OutFiles.Reserve(InChanges.Num());
+	for (const FChangeRecord& Change : InChanges)
 	{
-		const TArray<FXmlNode*>& ItemNodes = ChangesNode->GetChildrenNodes();
-		OutFiles.Reserve(ItemNodes.Num());
-		for (const FXmlNode* ItemNode : ItemNodes)
+		if (!Change.bHasDstCmPath || !Change.bHasType)
 		{
-			check(ItemNode);
+			continue;
+		}
 
-			const FXmlNode* PathNode = ItemNode->FindChildNode(DstCmPath);
-			const FXmlNode* TypeNode = ItemNode->FindChildNode(Type);
-			if ((PathNode == nullptr) || (TypeNode == nullptr))
-			{
-				continue;
-			}
+		// Note: remove the leading '/' from the server path to make it relative to the root of the workspace
+		FString FileName = Change.DstCmPath.RightChop(1);
+		const EWorkspaceState WorkspaceState = StateFromType(Change.Type);
+		FPlasticSourceControlStateRef State = MakeShareable(new FPlasticSourceControlState(MoveTemp(FileName), WorkspaceState));
+		State->RepSpec = RootRepSpec;
 
-			// Note: remove the leading '/' from the server path to make it relative to the root of the workspace
-			FString FileName = PathNode->GetContent().RightChop(1);
-			const EWorkspaceState WorkspaceState = StateFromType(TypeNode->GetContent());
-			FPlasticSourceControlStateRef State = MakeShareable(new FPlasticSourceControlState(MoveTemp(FileName), WorkspaceState));
-			State->RepSpec = RootRepSpec;
+		if (WorkspaceState == EWorkspaceState::Moved)
+		{
+			State->MovedFrom = Change.SrcCmPath.RightChop(1); // remove the leading '/' character from the server path
+		}
 
-			if (WorkspaceState == EWorkspaceState::Moved)
-			{
-				if (const FXmlNode* SrcNode = ItemNode->FindChildNode(SrcCmPath))
+		// Add one revision to be able to fetch the file content for diff, if it's not marked for deletion.
+		if ((WorkspaceState != EWorkspaceState::Deleted) && (State->History.Num() == 0))
+		{
+			const TSharedRef<FPlasticSourceControlRevision, ESPMode::ThreadSafe> SourceControlRevision = MakeShareable(new FPlasticSourceControlRevision);
+			SourceControlRevision->State = &State.Get();
+			SourceControlRevision->Filename = State->GetFilename();
+			SourceControlRevision->Revision = FString::Printf(TEXT("cs:%d"), InChangeset->ChangesetId);
+			SourceControlRevision->ChangesetNumber = InChangeset->ChangesetId; // Note: for display in the diff window only
+			SourceControlRevision->ChangesetMetadata = FPlasticSourceControlChangesetMetadataTable::Get().FindOrAdd(RootRepSpec, InChangeset->ChangesetId,
+				[&InChangeset](FPlasticSourceControlChangesetMetadata& OutMetadata)
 				{
-					State->MovedFrom = SrcNode->GetContent().RightChop(1); // remove the leading '/' character from the server path
+					OutMetadata.Description = InChangeset->Comment;
+					OutMetadata.UserName = PlasticSourceControlUtils::UserNameToDisplayName(InChangeset->CreatedBy);
+					OutMetadata.Branch = InChangeset->Branch;
+					OutMetadata.Date = InChangeset->Date;
 				}
-			}
+			);
 
-			// Add one revision to be able to fetch the file content for diff, if it's not marked for deletion.
-			if ((WorkspaceState != EWorkspaceState::Deleted) && (State->History.Num() == 0))
-			{
-				const TSharedRef<FPlasticSourceControlRevision, ESPMode::ThreadSafe> SourceControlRevision = MakeShareable(new FPlasticSourceControlRevision);
-				SourceControlRevision->State = &State.Get();
-				SourceControlRevision->Filename = State->GetFilename();
-				SourceControlRevision->Revision = FString::Printf(TEXT("cs:%d"), InChangeset->ChangesetId);
-				SourceControlRevision->ChangesetNumber = InChangeset->ChangesetId; // Note: for display in the diff window only
-				SourceControlRevision->Date = InChangeset->Date; // Note: not yet used for display as of UE5.2
-
-				State->History.Add(SourceControlRevision);
-			}
+			State->History.Add(SourceControlRevision);
+		}
 
-			// Note: in case of a Moved file, it appears twice in the list; just update the first entry (set as a "Changed") with the "Move" status
-			if (FPlasticSourceControlStateRef* ExistingState = OutFiles.FindByPredicate(
-				[&State](const TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>& InState)
-				{
-					return InState->GetFilename().Equals(State->GetFilename());
-				}))
-			{
-				(*ExistingState)->WorkspaceState = State->WorkspaceState;
-				(*ExistingState)->MovedFrom = State->MovedFrom;
-			}
-			else
+		// Note: in case of a Moved file, it appears twice in the list; just update the first entry (set as a "Changed") with the "Move" status
+		if (FPlasticSourceControlStateRef* ExistingState = OutFiles.FindByPredicate(
+			[&State](const TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>& InState)
 			{
-				OutFiles.Add(MoveTemp(State));
-			}
+				return InState->GetFilename().Equals(State->GetFilename());
+			}))
+		{
+			(*ExistingState)->WorkspaceState = State->WorkspaceState;
+			(*ExistingState)->MovedFrom = State->MovedFrom;
+		}
+		else
+		{
+			OutFiles.Add(MoveTemp(State));
 		}
 	}
 }
@@ -1901,57 +2492,108 @@ static void ParseChangesInChangeset(const FXmlNode* InChangesetNode, const FPlas
   </Changeset>
 </LogList>
 */
-static bool ParseLogResults(const FXmlFile& InXmlResult, const FPlasticSourceControlChangesetRef& InChangeset, TArray<FPlasticSourceControlStateRef>& OutFiles)
+class FLogResultsReader final : public FPlasticSourceControlXmlStreamReader
 {
-	static const FString LogList(TEXT("LogList"));
-	static const FString ChangesetId(TEXT("ChangesetId"));
-	static const FString Branch(TEXT("Branch"));
-	static const FString Comment(TEXT("Comment"));
-	static const FString Owner(TEXT("Owner"));
-	static const FString Date(TEXT("Date"));
-
-	const FXmlNode* LogListNode = InXmlResult.GetRootNode();
-	if (LogListNode == nullptr || LogListNode->GetTag() != LogList)
+public:
+	FLogResultsReader()
+		: FPlasticSourceControlXmlStreamReader(TEXT("LogList"))
 	{
-		return false;
 	}
 
-	const TArray<FXmlNode*>& ChangesetsNodes = LogListNode->GetChildrenNodes();
-	if (ChangesetsNodes.Num() != 1 || ChangesetsNodes[0] == nullptr)
+	/** Number of <Changeset> elements found */
+	int32 NumChangesets = 0;
+
+	/** Content of the <ChangesetId> of the changeset */
+	int32 ChangesetId = ISourceControlState::INVALID_REVISION;
+
+	/** Changes listed in the changeset */
+	TArray<FChangeRecord> Changes;
+
+private:
+	virtual bool OnElementStart(const FString& InName, const int32 InDepth) override
 	{
-		return false;
+		static const FString ChangesTag(TEXT("Changes"));
+
+		if (InDepth == 1)
+		{
+			// Note: there should be only one changeset, and anything else is an error
+			NumChangesets++;
+		}
+		else if ((InDepth == 2) && (InName == ChangesTag))
+		{
+			bInChanges = true;
+		}
+		else if ((InDepth == 3) && bInChanges)
+		{
+			Changes.AddDefaulted();
+		}
+
+		return true;
 	}
 
-	FXmlNode* ChangesetNode = ChangesetsNodes[0];
-	const FXmlNode* ChangesetIdNode = ChangesetNode->FindChildNode(ChangesetId);
-	if (ChangesetIdNode == nullptr || InChangeset->ChangesetId != FCString::Atoi(*ChangesetIdNode->GetContent()))
+	virtual bool OnElementEnd(const FString& InName, FString&& InContent, const int32 InDepth) override
 	{
-		return false;
-	}
+		static const FString ChangesetIdTag(TEXT("ChangesetId"));
+		static const FString ChangesTag(TEXT("Changes"));
+		static const FString Type(TEXT("Type"));
+		static const FString SrcCmPath(TEXT("SrcCmPath"));
+		static const FString DstCmPath(TEXT("DstCmPath"));
+
+		if ((InDepth == 4) && bInChanges && (Changes.Num() > 0))
+		{
+			FChangeRecord& Change = Changes.Last();
+			if (InName == DstCmPath)
+			{
+				Change.bHasDstCmPath = true;
+				Change.DstCmPath = MoveTemp(InContent);
+			}
+			else if (InName == Type)
+			{
+				Change.bHasType = true;
+				Change.Type = MoveTemp(InContent);
+			}
+			else if (InName == SrcCmPath)
+			{
+				Change.SrcCmPath = MoveTemp(InContent);
+			}
+		}
+		else if (InDepth == 2)
+		{
+			if (InName == ChangesetIdTag)
+			{
+				ChangesetId = FCString::Atoi(*InContent);
+			}
+			else if (InName == ChangesTag)
+			{
+				bInChanges = false;
+			}
+		}
 
-	// List Files States and create a Revision
-	ParseChangesInChangeset(ChangesetNode, InChangeset, OutFiles);
+		return true;
+	}
 
-	return true;
-}
+	bool bInChanges = false;
+};
 
-bool ParseLogResults(const FString& InXmlFilename, const FPlasticSourceControlChangesetRef& InChangeset, TArray<FPlasticSourceControlStateRef>& OutFiles)
+bool ParseLogResults(FString&& InXmlResults, const FPlasticSourceControlChangesetRef& InChangeset, TArray<FPlasticSourceControlStateRef>& OutFiles)
 {
-	bool bResult = false;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseLogResults);
 
-	FXmlFile XmlFile;
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseLogResults::LoadXml);
-		bResult = XmlFile.LoadFile(InXmlFilename);
-	}
+	FLogResultsReader Reader;
+	bool bResult = Reader.ParseBuffer(InXmlResults);
 	if (bResult)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseLogResults::ParseXml);
-		bResult = ParseLogResults(XmlFile, InChangeset, OutFiles);
+		if ((Reader.NumChangesets != 1) || (Reader.ChangesetId != InChangeset->ChangesetId))
+		{
+			return false;
+		}
+
+		// List Files States and create a Revision
+		ParseChangesInChangeset(Reader.Changes, InChangeset, OutFiles);
 	}
 	else
 	{
-		UE_LOG(LogSourceControl, Error, TEXT("ParseLogResults: XML parse error '%s'"), *XmlFile.GetLastError())
+		UE_LOG(LogSourceControl, Error, TEXT("ParseLogResults: XML parse error '%s'"), *Reader.GetLastError())
 	}
 
 	return bResult;
@@ -1980,88 +2622,138 @@ bool ParseLogResults(const FString& InXmlFilename, const FPlasticSourceControlCh
   [...]
 </PLASTICQUERY>
 */
-static bool ParseBranchesResults(const FXmlFile& InXmlResult, TArray<FPlasticSourceControlBranchRef>& OutBranches)
+class FBranchesResultsReader final : public FPlasticSourceControlXmlStreamReader
 {
-	static const FString PlasticQuery(TEXT("PLASTICQUERY"));
-	static const FString Branch(TEXT("BRANCH"));
-	static const FString Comment(TEXT("COMMENT"));
-	static const FString Date(TEXT("DATE"));
-	static const FString Owner(TEXT("OWNER"));
-	static const FString Name(TEXT("NAME"));
-	static const FString RepName(TEXT("REPNAME"));
-	static const FString RepServer(TEXT("REPSERVER"));
-
-	const FXmlNode* PlasticQueryNode = InXmlResult.GetRootNode();
-	if (PlasticQueryNode == nullptr || PlasticQueryNode->GetTag() != PlasticQuery)
+public:
+	explicit FBranchesResultsReader(TArray<FPlasticSourceControlBranchRef>& OutBranches)
+		: FPlasticSourceControlXmlStreamReader(TEXT("PLASTICQUERY"))
+		, Branches(OutBranches)
 	{
-		return false;
 	}
 
-	const TArray<FXmlNode*>& BranchesNodes = PlasticQueryNode->GetChildrenNodes();
-	OutBranches.Reserve(BranchesNodes.Num());
-	for (const FXmlNode* BranchNode : BranchesNodes)
+private:
+	virtual bool OnElementStart(const FString& InName, const int32 InDepth) override
 	{
-		check(BranchNode);
-		const FXmlNode* NameNode = BranchNode->FindChildNode(Name);
-		if (NameNode == nullptr)
+		if (InDepth == 1)
 		{
-			continue;
+			CurrentBranch = MakeShareable(new FPlasticSourceControlBranch());
+			bHasName = false;
+			RepName.Reset();
+			RepServer.Reset();
 		}
 
-		FPlasticSourceControlBranchRef BranchRef = MakeShareable(new FPlasticSourceControlBranch());
+		return true;
+	}
 
-		BranchRef->Name = DecodeXmlEntities(NameNode->GetContent());
+	virtual bool OnElementEnd(const FString& InName, FString&& InContent, const int32 InDepth) override
+	{
+		static const FString Comment(TEXT("COMMENT"));
+		static const FString Date(TEXT("DATE"));
+		static const FString Owner(TEXT("OWNER"));
+		static const FString Name(TEXT("NAME"));
+		static const FString RepNameTag(TEXT("REPNAME"));
+		static const FString RepServerTag(TEXT("REPSERVER"));
 
-		if (const FXmlNode* CommentNode = BranchNode->FindChildNode(Comment))
-		{
-			BranchRef->Comment = DecodeXmlEntities(CommentNode->GetContent());
-		}
-		if (const FXmlNode* DateNode = BranchNode->FindChildNode(Date))
-		{
-			const FString& DateIso = DateNode->GetContent();
-			FDateTime::ParseIso8601(*DateIso, BranchRef->Date);
-		}
-		if (const FXmlNode* OwnerNode = BranchNode->FindChildNode(Owner))
+		if ((InDepth == 2) && CurrentBranch.IsValid())
 		{
-			// Note: keeping the full email address as the owner name so we can display both the short and full name in the tooltip
-			BranchRef->CreatedBy = OwnerNode->GetContent();
+			if (InName == Name)
+			{
+				CurrentBranch->Name = DecodeXmlEntities(MoveTemp(InContent));
+				bHasName = true;
+			}
+			else if (InName == Comment)
+			{
+				CurrentBranch->Comment = DecodeXmlEntities(MoveTemp(InContent));
+			}
+			else if (InName == Date)
+			{
+				DateParser.Parse(InContent, CurrentBranch->Date);
+			}
+			else if (InName == Owner)
+			{
+				// Note: keeping the full email address as the owner name so we can display both the short and full name in the tooltip
+				CurrentBranch->CreatedBy = MoveTemp(InContent);
+			}
+			else if (InName == RepNameTag)
+			{
+				RepName = MoveTemp(InContent);
+			}
+			else if (InName == RepServerTag)
+			{
+				RepServer = MoveTemp(InContent);
+			}
 		}
-		if (const FXmlNode* RepNameNode = BranchNode->FindChildNode(RepName))
+		else if ((InDepth == 1) && CurrentBranch.IsValid())
 		{
-			if (const FXmlNode* RepServerNode = BranchNode->FindChildNode(RepServer))
+			if (bHasName)
 			{
-				BranchRef->Repository = RepNameNode->GetContent() + TEXT("@") + RepServerNode->GetContent();
+				if (RepName.IsSet() && RepServer.IsSet())
+				{
+					CurrentBranch->Repository = RepName.GetValue() + TEXT("@") + RepServer.GetValue();
+				}
+				Branches.Add(CurrentBranch.ToSharedRef());
 			}
+			CurrentBranch.Reset();
 		}
 
-		OutBranches.Add(MoveTemp(BranchRef));
+		return true;
 	}
 
-	return true;
-}
+	TArray<FPlasticSourceControlBranchRef>& Branches;
 
-bool ParseBranchesResults(const FString& InXmlFilename, TArray<FPlasticSourceControlBranchRef>& OutBranches)
+	/** Branch being parsed */
+	TSharedPtr<FPlasticSourceControlBranch, ESPMode::ThreadSafe> CurrentBranch;
+	bool bHasName = false;
+	TOptional<FString> RepName;
+	TOptional<FString> RepServer;
+
+	FPlasticDateParser DateParser;
+};
+
+bool ParseBranchesResults(FString&& InXmlResults, TArray<FPlasticSourceControlBranchRef>& OutBranches)
 {
-	bool bResult = false;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseBranchesResults);
 
-	FXmlFile XmlFile;
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseBranchesResults::LoadXml);
-		bResult = XmlFile.LoadFile(InXmlFilename);
-	}
-	if (bResult)
+	FBranchesResultsReader Reader(OutBranches);
+	const bool bResult = Reader.ParseBuffer(InXmlResults);
+	if (!bResult)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseBranchesResults::ParseXml);
-		bResult = ParseBranchesResults(XmlFile, OutBranches);
-	}
-	else
-	{
-		UE_LOG(LogSourceControl, Error, TEXT("ParseBranchesResults: XML parse error '%s'"), *XmlFile.GetLastError())
+		UE_LOG(LogSourceControl, Error, TEXT("ParseBranchesResults: XML parse error '%s'"), *Reader.GetLastError())
 	}
 
 	return bResult;
 }
 
+/**
+ * Parse results of the 'cm find branches --format="#_#{name}#_#{date}#_#{owner}#_#{repname}#_#{repserver}#_#{comment}" --nototal' command.
+ *
+ * Results of the find command looks like the following:
+#_#/main#_#2023-10-18T15:08:49+02:00#_#sebastien.rombauts@unity3d.com#_#UE5PlasticPluginDev#_#SRombautsU@cloud#_#main branch
+#_#/main/ScalableLocks#_#2023-11-21T13:35:04+01:00#_#sebastien.rombauts@unity3d.com#_#UE5PlasticPluginDev#_#SRombautsU@cloud#_#
+*/
+bool ParseBranchesResults(const TArray<FString>& InResults, TArray<FPlasticSourceControlBranchRef>& OutBranches)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlParsers::ParseBranchesResultsFormat);
+
+	FPlasticDateParser DateParser;
+	OutBranches.Reserve(InResults.Num());
+	return ParseFindFormatResults(InResults, 6, [&OutBranches, &DateParser](TArray<FString>& InOutFields)
+	{
+		if (InOutFields[0].IsEmpty())
+		{
+			return;
+		}
+		FPlasticSourceControlBranchRef Branch = MakeShareable(new FPlasticSourceControlBranch());
+		Branch->Name = MoveTemp(InOutFields[0]);
+		DateParser.Parse(InOutFields[1], Branch->Date);
+		// Note: keeping the full email address as the owner name so we can display both the short and full name in the tooltip
+		Branch->CreatedBy = MoveTemp(InOutFields[2]);
+		Branch->Repository = InOutFields[3] + TEXT("@") + InOutFields[4];
+		Branch->Comment = MoveTemp(InOutFields[5]);
+		OutBranches.Add(MoveTemp(Branch));
+	});
+}
+
 /* Parse results of the 'cm merge --xml=tempfile.xml --encoding="utf-8" --merge <branch-name>' command.
  *
  * Results of the merge command looks like that:
@@ -2104,6 +2796,7 @@ static bool ParseMergeResults(const FXmlFile& InXmlResult, TArray<FString>& OutF
 		return false;
 	}
 
+	TSet<FString> UniqueFiles(OutFiles);
 	for (const FString& MergeType : MergeTypes)
 	{
 		if (const FXmlNode* MergeTypeNode = MergeNode->FindChildNode(MergeType))
@@ -2116,9 +2809,11 @@ static bool ParseMergeResults(const FXmlFile& InXmlResult, TArray<FString>& OutF
 				{
 					FString Filename = FPaths::Combine(WorkspaceRoot, PathNode->GetContent());
 					FPaths::NormalizeFilename(Filename);
-					if (!OutFiles.Contains(Filename))
+					bool bIsAlreadyInSet = false;
+					UniqueFiles.Add(Filename, &bIsAlreadyInSet);
+					if (!bIsAlreadyInSet)
 					{
-						OutFiles.Add(Filename);
+						OutFiles.Add(MoveTemp(Filename));
 					}
 				}
 			}
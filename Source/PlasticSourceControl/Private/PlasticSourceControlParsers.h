@@ -8,12 +8,20 @@
 
 class FPlasticSourceControlChangelistState;
 class FPlasticSourceControlLock;
+class FPlasticSourceControlLocksIndex;
 class FPlasticSourceControlRevision;
 class FPlasticSourceControlState;
 typedef TSharedRef<class FPlasticSourceControlBranch, ESPMode::ThreadSafe> FPlasticSourceControlBranchRef;
 typedef TSharedRef<class FPlasticSourceControlChangeset, ESPMode::ThreadSafe> FPlasticSourceControlChangesetRef;
+typedef TSharedRef<class FPlasticSourceControlLock, ESPMode::ThreadSafe> FPlasticSourceControlLockRef;
 typedef TSharedRef<class FPlasticSourceControlState, ESPMode::ThreadSafe> FPlasticSourceControlStateRef;
 
+/**
+ * Separator of the fields of the 'cm find --format' commands, also starting each of their records,
+ * followed by the {date} in the fixed --dateformat="yyyy-MM-ddTHH:mm:sszzz", see ParseChangesetsResults() and ParseBranchesResults()
+ */
+#define FIND_FORMAT_SEPARATOR TEXT("#_#")
+
 namespace PlasticSourceControlParsers
 {
 
@@ -29,6 +37,29 @@ public:
 	FString SourceChangeset;
 };
 
+/**
+ * Parser of the dates in the fixed ISO 8601 format emitted by cm, eg "2024-04-03T14:59:31+02:00" or "2024-04-03T12:59:31.1234567Z"
+ *
+ * Dates of a same result are often close to one another, so it caches the date and hour of the last date parsed.
+ * Falls back to FDateTime::ParseIso8601() on any deviation from this format, so it can be used for any ISO 8601 date.
+ */
+class FPlasticDateParser
+{
+public:
+	/**
+	 * Parse an ISO 8601 date into an UTC date, with the same result as FDateTime::ParseIso8601() up to milliseconds;
+	 * finer fractional seconds, up to the 7 digits emitted by cm, are kept to the tick instead of depending on the engine version.
+	 */
+	bool Parse(const FString& InDate, FDateTime& OutDate);
+
+private:
+	static const int32 PrefixLen = 13; // "YYYY-MM-DDTHH"
+
+	/** Date and hour of the last date parsed, and the matching ticks */
+	TCHAR CachedPrefix[PrefixLen] = {};
+	int64 CachedPrefixTicks = -1;
+};
+
 /**
 	* Helper struct for RemoveRedundantErrors()
 	*/
@@ -66,17 +97,26 @@ void ParseFileStatusResult(TArray<FString>&& InFiles, const TArray<FString>& InR
 void ParseDirectoryStatusResult(const FString& InDir, const TArray<FString>& InResults, TArray<FPlasticSourceControlState>& OutStates);
 
 void ParseFileinfoResults(const TArray<FString>& InResults, TArray<FPlasticSourceControlState>& InOutStates);
+void ParseFileinfoResults(const TArray<FString>& InResults, const FPlasticSourceControlLocksIndex& InLocksIndex, TArray<FPlasticSourceControlState>& InOutStates);
 
-bool ParseHistoryResults(const bool bInUpdateHistory, const FString& InXmlFilename, TArray<FPlasticSourceControlState>& InOutStates);
+/** Set the lock information of a file state (locked or retained by, where, which branch) from the locks matching its server path */
+void UpdateStateLocks(const TArray<FPlasticSourceControlLockRef>& InMatchingLocks, const FString& InBranchName, FPlasticSourceControlState& InOutState);
+
+/**
+ * Parse the XML results of a history command, parsing the revisions of large results in parallel
+ * @param	InHistoryPageLimit		Number of revisions requested for a page of the history, 0 if the full history was requested
+ * @param	bInForceSingleThread	Parse on the calling thread only, eg. to compare it with the parallel parsing
+ */
+bool ParseHistoryResults(const bool bInUpdateHistory, const int32 InHistoryPageLimit, FString&& InXmlResults, TArray<FPlasticSourceControlState>& InOutStates, const bool bInForceSingleThread = false);
 
-bool ParseUpdateResults(const FString& InResults, TArray<FString>& OutFiles);
+bool ParseUpdateResults(FString&& InXmlResults, TArray<FString>& OutFiles);
 bool ParseUpdateResults(const TArray<FString>& InResults, TArray<FString>& OutFiles);
 
 FText ParseCheckInResults(const TArray<FString>& InResults);
 
 #if ENGINE_MAJOR_VERSION == 5
 
-bool ParseChangelistsResults(const FString& InXmlFilename, TArray<FPlasticSourceControlChangelistState>& OutChangelistsStates, TArray<TArray<FPlasticSourceControlState>>& OutCLFilesStates);
+bool ParseChangelistsResults(FString&& InXmlResults, TArray<FPlasticSourceControlChangelistState>& OutChangelistsStates, TArray<TArray<FPlasticSourceControlState>>& OutCLFilesStates);
 
 bool ParseShelveDiffResult(const FString InWorkspaceRoot, TArray<FString>&& InResults, FPlasticSourceControlChangelistState& InOutChangelistsState);
 bool ParseShelveDiffResults(const FString InWorkspaceRoot, TArray<FString>&& InResults, TArray<FPlasticSourceControlRevision>& OutBaseRevisions);
@@ -86,10 +126,14 @@ bool ParseShelvesResult(const FString& InResults, FString& OutComment, FDateTime
 
 #endif
 
-bool ParseChangesetsResults(const FString& InXmlFilename, TArray<FPlasticSourceControlChangesetRef>& OutChangesets);
-bool ParseLogResults(const FString& InXmlFilename, const FPlasticSourceControlChangesetRef& InChangeset, TArray<FPlasticSourceControlStateRef>& OutFiles);
+bool ParseChangesetsResults(FString&& InXmlResults, TArray<FPlasticSourceControlChangesetRef>& OutChangesets);
+/** Parse the lines of the results of 'cm find changesets --format', keeping their empty lines since they can be part of multi-line comments */
+bool ParseChangesetsResults(const TArray<FString>& InResults, TArray<FPlasticSourceControlChangesetRef>& OutChangesets);
+bool ParseLogResults(FString&& InXmlResults, const FPlasticSourceControlChangesetRef& InChangeset, TArray<FPlasticSourceControlStateRef>& OutFiles);
 
-bool ParseBranchesResults(const FString& InXmlFilename, TArray<FPlasticSourceControlBranchRef>& OutBranches);
+bool ParseBranchesResults(FString&& InXmlResults, TArray<FPlasticSourceControlBranchRef>& OutBranches);
+/** Parse the lines of the results of 'cm find branches --format', keeping their empty lines since they can be part of multi-line comments */
+bool ParseBranchesResults(const TArray<FString>& InResults, TArray<FPlasticSourceControlBranchRef>& OutBranches);
 
 bool ParseMergeResults(const FString& InResult, TArray<FString>& OutFiles);
 
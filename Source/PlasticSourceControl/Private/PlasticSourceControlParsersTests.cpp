@@ -0,0 +1,1152 @@
+// Copyright (c) 2024 Unity Technologies
+
+#include "PlasticSourceControlParsers.h"
+#include "PlasticSourceControlLock.h"
+#include "PlasticSourceControlBranch.h"
+#include "PlasticSourceControlChangeset.h"
+#include "PlasticSourceControlRevision.h"
+#include "PlasticSourceControlState.h"
+#include "PlasticSourceControlSyntheticOutputs.h"
+#include "PlasticSourceControlUtils.h"
+#include "ScopedTempFile.h"
+
+#if ENGINE_MAJOR_VERSION == 5
+#include "PlasticSourceControlChangelist.h"
+#include "PlasticSourceControlChangelistState.h"
+#endif
+
+#include "Algo/Count.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#include "Misc/AutomationTest.h"
+
+/**
+ * Micro-benchmarks of the parsers of cm outputs, on synthetic outputs of 1k, 10k and 100k entries,
+ * and for the larger XML results, of 10 MB and 100 MB, as listed for large repositories.
+ *
+ * Each benchmark checks the number of entries parsed, and reports its throughput, so that a regression shows in CI logs.
+ * Use Unreal Insights with "-trace=cpu,memory" for the detail of the time and allocations of each parser.
+ */
+namespace PlasticSourceControlParsersBenchmarks
+{
+
+static void GetBenchmarkSizes(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands)
+{
+	OutBeautifiedNames.Add(TEXT("1k"));
+	OutTestCommands.Add(TEXT("1000"));
+	OutBeautifiedNames.Add(TEXT("10k"));
+	OutTestCommands.Add(TEXT("10000"));
+	OutBeautifiedNames.Add(TEXT("100k"));
+	OutTestCommands.Add(TEXT("100000"));
+}
+
+// Sizes of the XML benchmarks: also by size of the results, see GetNumEntries()
+static void GetXmlBenchmarkSizes(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands)
+{
+	GetBenchmarkSizes(OutBeautifiedNames, OutTestCommands);
+	OutBeautifiedNames.Add(TEXT("10MB"));
+	OutTestCommands.Add(TEXT("10MB"));
+	OutBeautifiedNames.Add(TEXT("100MB"));
+	OutTestCommands.Add(TEXT("100MB"));
+}
+
+static void ReportThroughput(FAutomationTestBase& InTest, const TCHAR* InParserName, const int32 InNumEntries, const int32 InNumChars, const double InElapsedSeconds)
+{
+	const double ElapsedSeconds = FMath::Max(InElapsedSeconds, 1e-9);
+	InTest.AddInfo(FString::Printf(TEXT("%s: %d entries (%.1f MB) parsed in %.3lfs: %.0lf entries/s, %.1lf MB/s"),
+		InParserName, InNumEntries, InNumChars * sizeof(TCHAR) / (1024.0 * 1024.0), ElapsedSeconds,
+		InNumEntries / ElapsedSeconds, InNumChars * sizeof(TCHAR) / (1024.0 * 1024.0) / ElapsedSeconds));
+}
+
+static int32 NumChars(const FString& InResults)
+{
+	return InResults.Len();
+}
+
+static int32 NumChars(const TArray<FString>& InResults)
+{
+	int32 Num = 0;
+	for (const FString& Result : InResults)
+	{
+		Num += Result.Len() + 1;
+	}
+	return Num;
+}
+
+// Number of entries of a benchmark: either given directly, or for a size in MB, extrapolated by thousands of entries from the size of a sample of 1000 entries
+static int32 GetNumEntries(const FString& InParameters, TFunctionRef<int32(const int32 InNumEntries)> InGetNumChars)
+{
+	if (InParameters.EndsWith(TEXT("MB")))
+	{
+		static const int32 NumSampleEntries = 1000;
+		const int64 NumBytes = FCString::Atoi64(*InParameters) * 1024 * 1024;
+		const int64 NumSampleBytes = FMath::Max<int64>(InGetNumChars(NumSampleEntries) * sizeof(TCHAR), 1);
+		return static_cast<int32>(FMath::Max<int64>(NumBytes / NumSampleBytes, 1) * NumSampleEntries);
+	}
+	return FCString::Atoi(*InParameters);
+}
+
+/**
+ * Benchmark a parser on a synthetic output: generate the output for the size of the benchmark, time its parsing, report the throughput and check the number of entries parsed
+ * @param	InParameters	Size of the benchmark, see GetBenchmarkSizes() and GetXmlBenchmarkSizes()
+ * @param	InGenerate		Generate the output for a number of entries, not timed
+ * @param	InParse			Parse the output, returning the number of entries parsed
+ * @returns the time spent parsing, in seconds
+ */
+template<typename OutputType>
+static double BenchmarkParser(FAutomationTestBase& InTest, const TCHAR* InParserName, const FString& InParameters, TFunctionRef<OutputType(const int32 InNumEntries)> InGenerate, TFunctionRef<int32(OutputType&& InOutput)> InParse)
+{
+	const int32 NumEntries = GetNumEntries(InParameters, [&InGenerate](const int32 InNumEntries)
+	{
+		return NumChars(InGenerate(InNumEntries));
+	});
+	OutputType Output = InGenerate(NumEntries);
+	const int32 OutputNumChars = NumChars(Output);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumParsedEntries = InParse(MoveTemp(Output));
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	ReportThroughput(InTest, InParserName, NumEntries, OutputNumChars, ElapsedSeconds);
+	InTest.TestEqual(FString::Printf(TEXT("%s: number of entries"), InParserName), NumParsedEntries, NumEntries);
+
+	return ElapsedSeconds;
+}
+
+static TArray<FPlasticSourceControlState> MakeStates(const TArray<FString>& InFiles)
+{
+	TArray<FPlasticSourceControlState> States;
+	States.Reserve(InFiles.Num());
+	for (const FString& File : InFiles)
+	{
+		States.Add(FPlasticSourceControlState(CopyTemp(File)));
+	}
+	return States;
+}
+
+} // namespace PlasticSourceControlParsersBenchmarks
+
+using namespace PlasticSourceControlParsersBenchmarks;
+
+// Implement a benchmark run for each of the sizes returned by a function, see GetBenchmarkSizes()
+#define IMPLEMENT_PLASTIC_BENCHMARK(TClass, PrettyName, GetSizes) \
+	IMPLEMENT_COMPLEX_AUTOMATION_TEST(TClass, PrettyName, EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter) \
+	void TClass::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const \
+	{ \
+		GetSizes(OutBeautifiedNames, OutTestCommands); \
+	}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseDirectoryStatusResultBenchmark, "PlasticSCM.Benchmarks.ParseDirectoryStatusResult", GetBenchmarkSizes)
+
+bool FParseDirectoryStatusResultBenchmark::RunTest(const FString& Parameters)
+{
+	BenchmarkParser<TArray<FString>>(*this, TEXT("ParseDirectoryStatusResult"), Parameters,
+		[](const int32 InNumFiles)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateStatus(PlasticSourceControlSyntheticOutputs::GenerateFilenames(InNumFiles));
+		},
+		[](TArray<FString>&& InResults)
+		{
+			TArray<FPlasticSourceControlState> States;
+			PlasticSourceControlParsers::ParseDirectoryStatusResult(PlasticSourceControlSyntheticOutputs::WorkspaceRoot, InResults, States);
+			return States.Num();
+		});
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseFileinfoResultsBenchmark, "PlasticSCM.Benchmarks.ParseFileinfoResults", GetBenchmarkSizes)
+
+// Parse the locks of the files along with their fileinfo, as done by a status update
+bool FParseFileinfoResultsBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<FString> LockResults;
+	TArray<FPlasticSourceControlState> States;
+	TArray<FPlasticSourceControlLockRef> Locks;
+	BenchmarkParser<TArray<FString>>(*this, TEXT("ParseFileinfoResults"), Parameters,
+		[&LockResults, &States](const int32 InNumFiles)
+		{
+			const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(InNumFiles);
+			LockResults = PlasticSourceControlSyntheticOutputs::GenerateLockList(Files);
+			States = MakeStates(Files);
+			return PlasticSourceControlSyntheticOutputs::GenerateFileinfo(Files);
+		},
+		[&LockResults, &States, &Locks](TArray<FString>&& InResults)
+		{
+			Locks.Reserve(LockResults.Num());
+			for (const FString& LockResult : LockResults)
+			{
+				Locks.Add(MakeShareable(new FPlasticSourceControlLock(PlasticSourceControlParsers::ParseLockInfo(LockResult))));
+			}
+			const FPlasticSourceControlLocksIndex LocksIndex(Locks);
+			PlasticSourceControlParsers::ParseFileinfoResults(InResults, LocksIndex, States);
+			return States.Num();
+		});
+
+	TestEqual(TEXT("Locked file"), States[0].LockedId, Locks[0]->ItemId);
+	TestEqual(TEXT("Out of date file"), States[8].DepotRevisionChangeset, States[8].LocalRevisionChangeset + 1);
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseHistoryResultsBenchmark, "PlasticSCM.Benchmarks.ParseHistoryResults", GetXmlBenchmarkSizes)
+
+bool FParseHistoryResultsBenchmark::RunTest(const FString& Parameters)
+{
+	// The entries are the revisions, spread over the history of files
+	static const int32 NumRevisionsPerFile = 10;
+
+	// Compare parsing the revisions on the calling thread to parsing them in parallel, each from an empty metadata table
+	double ElapsedSeconds[2] = {};
+	for (const bool bForceSingleThread : { true, false })
+	{
+		const FScopedChangesetMetadataTable ScopedMetadataTable;
+		TArray<FPlasticSourceControlState> States;
+		ElapsedSeconds[bForceSingleThread ? 0 : 1] = BenchmarkParser<FString>(*this, bForceSingleThread ? TEXT("ParseHistoryResults (single thread)") : TEXT("ParseHistoryResults (parallel)"), Parameters,
+			[&States](const int32 InNumRevisions)
+			{
+				const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(InNumRevisions / NumRevisionsPerFile);
+				States = MakeStates(Files);
+				for (FPlasticSourceControlState& State : States)
+				{
+					State.DepotRevisionChangeset = MAX_int32;
+				}
+				return PlasticSourceControlSyntheticOutputs::GenerateHistoryXml(Files, NumRevisionsPerFile);
+			},
+			[this, &States, bForceSingleThread](FString&& InResults)
+			{
+				TestTrue(TEXT("Parsed"), PlasticSourceControlParsers::ParseHistoryResults(true, 0, MoveTemp(InResults), States, bForceSingleThread));
+				int32 NumParsedRevisions = 0;
+				for (const FPlasticSourceControlState& State : States)
+				{
+					NumParsedRevisions += State.History.Num();
+				}
+				return NumParsedRevisions;
+			});
+
+		TestEqual(TEXT("Decoded comment"), States[0].History[0]->GetDescription(), FString::Printf(TEXT("Fix & tweak <assets> of \"level %d\""), States[0].History[0]->ChangesetNumber));
+	}
+	AddInfo(FString::Printf(TEXT("ParseHistoryResults: parallel parsing %.2lfx faster than on a single thread"), ElapsedSeconds[0] / FMath::Max(ElapsedSeconds[1], 1e-9)));
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseChangesetsResultsBenchmark, "PlasticSCM.Benchmarks.ParseChangesetsResults", GetXmlBenchmarkSizes)
+
+bool FParseChangesetsResultsBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<FPlasticSourceControlChangesetRef> Changesets;
+	BenchmarkParser<FString>(*this, TEXT("ParseChangesetsResults"), Parameters,
+		[](const int32 InNumChangesets)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateChangesetsXml(InNumChangesets);
+		},
+		[this, &Changesets](FString&& InResults)
+		{
+			TestTrue(TEXT("Parsed"), PlasticSourceControlParsers::ParseChangesetsResults(MoveTemp(InResults), Changesets));
+			return Changesets.Num();
+		});
+
+	// Same changesets listed with the compact --format used by recent versions of cm
+	TArray<FPlasticSourceControlChangesetRef> FormatChangesets;
+	BenchmarkParser<TArray<FString>>(*this, TEXT("ParseChangesetsResults (format)"), Parameters,
+		[](const int32 InNumChangesets)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateChangesetsFormat(InNumChangesets);
+		},
+		[this, &FormatChangesets](TArray<FString>&& InResults)
+		{
+			TestTrue(TEXT("Parsed format"), PlasticSourceControlParsers::ParseChangesetsResults(InResults, FormatChangesets));
+			return FormatChangesets.Num();
+		});
+
+	if (FormatChangesets.Num() == Changesets.Num())
+	{
+		for (int32 Index = 0; Index < FMath::Min(Changesets.Num(), 4); Index++)
+		{
+			const FPlasticSourceControlChangeset& Changeset = *Changesets[Index];
+			const FPlasticSourceControlChangeset& FormatChangeset = *FormatChangesets[Index];
+			TestEqual(TEXT("Changeset id"), FormatChangeset.ChangesetId, Changeset.ChangesetId);
+			TestTrue(TEXT("Date"), FormatChangeset.Date == Changeset.Date);
+			TestEqual(TEXT("Owner"), FormatChangeset.CreatedBy, Changeset.CreatedBy);
+			TestEqual(TEXT("Branch"), FormatChangeset.Branch, Changeset.Branch);
+			TestTrue(TEXT("Comment"), FormatChangeset.Comment.StartsWith(Changeset.Comment));
+		}
+	}
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseBranchesResultsBenchmark, "PlasticSCM.Benchmarks.ParseBranchesResults", GetBenchmarkSizes)
+
+bool FParseBranchesResultsBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<FPlasticSourceControlBranchRef> Branches;
+	BenchmarkParser<FString>(*this, TEXT("ParseBranchesResults"), Parameters,
+		[](const int32 InNumBranches)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateBranchesXml(InNumBranches);
+		},
+		[this, &Branches](FString&& InResults)
+		{
+			TestTrue(TEXT("Parsed"), PlasticSourceControlParsers::ParseBranchesResults(MoveTemp(InResults), Branches));
+			return Branches.Num();
+		});
+
+	// Same branches listed with the compact --format used by recent versions of cm
+	TArray<FPlasticSourceControlBranchRef> FormatBranches;
+	BenchmarkParser<TArray<FString>>(*this, TEXT("ParseBranchesResults (format)"), Parameters,
+		[](const int32 InNumBranches)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateBranchesFormat(InNumBranches);
+		},
+		[this, &FormatBranches](TArray<FString>&& InResults)
+		{
+			TestTrue(TEXT("Parsed format"), PlasticSourceControlParsers::ParseBranchesResults(InResults, FormatBranches));
+			return FormatBranches.Num();
+		});
+
+	if (FormatBranches.Num() == Branches.Num())
+	{
+		for (int32 Index = 0; Index < FMath::Min(Branches.Num(), 4); Index++)
+		{
+			const FPlasticSourceControlBranch& Branch = *Branches[Index];
+			const FPlasticSourceControlBranch& FormatBranch = *FormatBranches[Index];
+			TestEqual(TEXT("Name"), FormatBranch.Name, Branch.Name);
+			TestTrue(TEXT("Date"), FormatBranch.Date == Branch.Date);
+			TestEqual(TEXT("Owner"), FormatBranch.CreatedBy, Branch.CreatedBy);
+			TestEqual(TEXT("Repository"), FormatBranch.Repository, Branch.Repository);
+			TestTrue(TEXT("Comment"), FormatBranch.Comment.StartsWith(Branch.Comment));
+		}
+	}
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+#if ENGINE_MAJOR_VERSION == 5
+
+// Up to the number of files pending after a large reimport
+static void GetChangelistsBenchmarkSizes(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands)
+{
+	OutBeautifiedNames.Add(TEXT("1k"));
+	OutTestCommands.Add(TEXT("1000"));
+	OutBeautifiedNames.Add(TEXT("10k"));
+	OutTestCommands.Add(TEXT("10000"));
+	OutBeautifiedNames.Add(TEXT("50k"));
+	OutTestCommands.Add(TEXT("50000"));
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseChangelistsResultsBenchmark, "PlasticSCM.Benchmarks.ParseChangelistsResults", GetChangelistsBenchmarkSizes)
+
+bool FParseChangelistsResultsBenchmark::RunTest(const FString& Parameters)
+{
+	static const int32 NumChangelists = 4;
+	TArray<FPlasticSourceControlChangelistState> ChangelistsStates;
+	TArray<TArray<FPlasticSourceControlState>> CLFilesStates;
+	const double ElapsedSeconds = BenchmarkParser<FString>(*this, TEXT("ParseChangelistsResults"), Parameters,
+		[](const int32 InNumFiles)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateChangelistsXml(PlasticSourceControlSyntheticOutputs::GenerateFilenames(InNumFiles), NumChangelists);
+		},
+		[this, &ChangelistsStates, &CLFilesStates](FString&& InResults)
+		{
+			TestTrue(TEXT("Parsed"), PlasticSourceControlParsers::ParseChangelistsResults(MoveTemp(InResults), ChangelistsStates, CLFilesStates));
+			// Moved files are listed twice but only parsed once
+			int32 NumParsedFiles = 0;
+			for (const TArray<FPlasticSourceControlState>& FilesStates : CLFilesStates)
+			{
+				NumParsedFiles += FilesStates.Num();
+			}
+			return NumParsedFiles;
+		});
+
+	TestEqual(TEXT("Number of changelists"), ChangelistsStates.Num(), NumChangelists);
+	int32 NumMovedFiles = 0;
+	for (const TArray<FPlasticSourceControlState>& FilesStates : CLFilesStates)
+	{
+		NumMovedFiles += Algo::CountIf(FilesStates, [](const FPlasticSourceControlState& InState) { return InState.WorkspaceState == EWorkspaceState::Moved; });
+	}
+	TestEqual(TEXT("Number of moved files"), NumMovedFiles, (FCString::Atoi(*Parameters) + 9) / 10);
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+#endif
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseUpdateResultsBenchmark, "PlasticSCM.Benchmarks.ParseUpdateResults", GetXmlBenchmarkSizes)
+
+// The XML results of an update of 100k files weigh tens of MB, with files listed twice to de-duplicate
+bool FParseUpdateResultsBenchmark::RunTest(const FString& Parameters)
+{
+	BenchmarkParser<FString>(*this, TEXT("ParseUpdateResults"), Parameters,
+		[](const int32 InNumFiles)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateUpdateXml(PlasticSourceControlSyntheticOutputs::GenerateFilenames(InNumFiles));
+		},
+		[this](FString&& InResults)
+		{
+			TArray<FString> UpdatedFiles;
+			TestTrue(TEXT("Parsed"), PlasticSourceControlParsers::ParseUpdateResults(MoveTemp(InResults), UpdatedFiles));
+			return UpdatedFiles.Num();
+		});
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FXmlResultFromTempFileBenchmark, "PlasticSCM.Benchmarks.XmlResultFromTempFile", GetBenchmarkSizes)
+
+// Compare parsing an XML result round-tripping through a temporary file, as written by cm, to parsing it directly from memory (see bReadXmlResultsFromShellOutput)
+bool FXmlResultFromTempFileBenchmark::RunTest(const FString& Parameters)
+{
+	{
+		// The result is written to the file as cm does, only reading it back being timed
+		const FScopedTempFile ResultFile(TEXT("FindChangeset-"), TEXT(".xml"));
+		BenchmarkParser<FString>(*this, TEXT("Temp file"), Parameters,
+			[&ResultFile](const int32 InNumChangesets)
+			{
+				FString Results = PlasticSourceControlSyntheticOutputs::GenerateChangesetsXml(InNumChangesets);
+				FFileHelper::SaveStringToFile(Results, *ResultFile.GetFilename(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+				return Results;
+			},
+			[this, &ResultFile](FString&& InResults)
+			{
+				TArray<FPlasticSourceControlChangesetRef> Changesets;
+				FString LoadedResults;
+				TestTrue(TEXT("Loaded"), FFileHelper::LoadFileToString(LoadedResults, *ResultFile.GetFilename()));
+				PlasticSourceControlParsers::ParseChangesetsResults(MoveTemp(LoadedResults), Changesets);
+				return Changesets.Num();
+			});
+	}
+
+	BenchmarkParser<FString>(*this, TEXT("Memory"), Parameters,
+		[](const int32 InNumChangesets)
+		{
+			return PlasticSourceControlSyntheticOutputs::GenerateChangesetsXml(InNumChangesets);
+		},
+		[](FString&& InResults)
+		{
+			TArray<FPlasticSourceControlChangesetRef> Changesets;
+			PlasticSourceControlParsers::ParseChangesetsResults(MoveTemp(InResults), Changesets);
+			return Changesets.Num();
+		});
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+namespace PlasticSourceControlLocksIndexTests
+{
+
+// Reference implementations of the lock matching, scanning all the locks, as done before the index
+
+static TArray<FPlasticSourceControlLockRef> FindMatchingLocksLinear(const TArray<FPlasticSourceControlLockRef>& InLocks, const FString& InPath)
+{
+	TArray<FPlasticSourceControlLockRef> MatchingLocks;
+	for (const FPlasticSourceControlLockRef& Lock : InLocks)
+	{
+		if (!Lock->Path.IsEmpty() && (Lock->Path == InPath))
+		{
+			MatchingLocks.Add(Lock);
+		}
+	}
+	return MatchingLocks;
+}
+
+static FPlasticSourceControlLockPtr FindLockForFileLinear(const TArray<FPlasticSourceControlLockRef>& InLocks, const FString& InFile)
+{
+	for (const FPlasticSourceControlLockRef& Lock : InLocks)
+	{
+		if (!Lock->Path.IsEmpty() && InFile.EndsWith(Lock->Path))
+		{
+			return Lock;
+		}
+	}
+	return nullptr;
+}
+
+static TArray<FPlasticSourceControlLockRef> MakeLocks(const TArray<FString>& InFiles)
+{
+	TArray<FPlasticSourceControlLockRef> Locks;
+	for (const FString& LockResult : PlasticSourceControlSyntheticOutputs::GenerateLockList(InFiles))
+	{
+		Locks.Add(MakeShareable(new FPlasticSourceControlLock(PlasticSourceControlParsers::ParseLockInfo(LockResult))));
+	}
+	return Locks;
+}
+
+} // namespace PlasticSourceControlLocksIndexTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlasticLocksIndexTest, "PlasticSCM.Locks.LocksIndex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FPlasticLocksIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace PlasticSourceControlLocksIndexTests;
+
+	const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(200);
+	TArray<FPlasticSourceControlLockRef> Locks = MakeLocks(Files);
+	// Same item locked for a second destination branch, a lock with a different case, a lock at the root whose path ends other filenames, and a lock that could not be parsed
+	FPlasticSourceControlLockRef SecondDestinationLock = MakeShareable(new FPlasticSourceControlLock(*Locks[3]));
+	SecondDestinationLock->DestinationBranch = TEXT("/release");
+	Locks.Add(SecondDestinationLock);
+	FPlasticSourceControlLockRef UpperCaseLock = MakeShareable(new FPlasticSourceControlLock(*Locks[5]));
+	UpperCaseLock->Path = UpperCaseLock->Path.ToUpper();
+	Locks.Insert(UpperCaseLock, 0);
+	FPlasticSourceControlLockRef RootLock = MakeShareable(new FPlasticSourceControlLock());
+	RootLock->ItemId = 42;
+	RootLock->Path = FPaths::GetCleanFilename(Files[7]);
+	RootLock->Path.InsertAt(0, TEXT('/'));
+	Locks.Add(RootLock);
+	Locks.Add(MakeShareable(new FPlasticSourceControlLock(PlasticSourceControlParsers::ParseLockInfo(TEXT("not a lock")))));
+
+	const FPlasticSourceControlLocksIndex LocksIndex(Locks);
+	TestEqual(TEXT("Number of locks"), LocksIndex.GetLocks().Num(), Locks.Num());
+
+	TArray<FString> Paths;
+	for (const FString& File : Files)
+	{
+		Paths.Add(File.RightChop(FCString::Strlen(PlasticSourceControlSyntheticOutputs::WorkspaceRoot) - 1));
+	}
+	Paths.Add(RootLock->Path);
+	Paths.Add(FString());
+	for (const FString& Path : Paths)
+	{
+		TestTrue(FString::Printf(TEXT("Locks on '%s'"), *Path), LocksIndex.FindByPath(Path) == FindMatchingLocksLinear(Locks, Path));
+	}
+
+	TArray<FString> Filenames = Files;
+	Filenames.Add(Files[5].ToLower());
+	Filenames.Add(TEXT("C:/Workspace/OtherProject/Content/Unrelated.uasset"));
+	Filenames.Add(FString());
+	for (const FString& Filename : Filenames)
+	{
+		TestTrue(FString::Printf(TEXT("Lock of '%s'"), *Filename), LocksIndex.FindByFilename(Filename) == FindLockForFileLinear(Locks, Filename));
+	}
+
+	TestEqual(TEXT("Locks of an item locked for two destination branches"), LocksIndex.FindByItemId(Locks[4]->ItemId).Num(), 2);
+	TestEqual(TEXT("Locks of an unknown item"), LocksIndex.FindByItemId(-42).Num(), 0);
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlasticLocksChangesTest, "PlasticSCM.Locks.LocksChanges", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FPlasticLocksChangesTest::RunTest(const FString& Parameters)
+{
+	const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(200);
+	TArray<FPlasticSourceControlLock> Locks;
+	for (const FString& LockResult : PlasticSourceControlSyntheticOutputs::GenerateLockList(Files))
+	{
+		Locks.Add(PlasticSourceControlParsers::ParseLockInfo(LockResult));
+	}
+	// Same item locked for a second destination branch
+	FPlasticSourceControlLock SecondDestinationLock(Locks[3]);
+	SecondDestinationLock.DestinationBranch = TEXT("/release");
+	Locks.Add(SecondDestinationLock);
+
+	const FPlasticSourceControlLocksIndex PreviousLocksIndex(FPlasticSourceControlLocksIndex(), CopyTemp(Locks));
+	TestEqual(TEXT("Locks added by the first list"), PreviousLocksIndex.GetChanges().Added.Num(), Locks.Num());
+
+	// Next list: one lock released, one lock changing owner, one lock moved, one new lock, and the second destination lock removed
+	TArray<FPlasticSourceControlLock> NextLocks = Locks;
+	NextLocks.RemoveAt(NextLocks.Num() - 1);
+	NextLocks.RemoveAt(1);
+	NextLocks[4].Owner = TEXT("someone.else@unity3d.com");
+	NextLocks[5].Path = TEXT("/Content/Moved.uasset");
+	FPlasticSourceControlLock NewLock;
+	NewLock.ItemId = 42;
+	NewLock.Path = TEXT("/Content/New.uasset");
+	NewLock.DestinationBranch = TEXT("/main");
+	NextLocks.Insert(NewLock, 0);
+
+	const FPlasticSourceControlLocksIndex LocksIndex(PreviousLocksIndex, MoveTemp(NextLocks));
+	const FPlasticSourceControlLocksChanges& Changes = LocksIndex.GetChanges();
+	TestTrue(TEXT("Previous serial"), LocksIndex.GetPreviousSerial() == PreviousLocksIndex.GetSerial());
+	TestEqual(TEXT("Number of locks"), LocksIndex.GetLocks().Num(), Locks.Num() - 1);
+	TestEqual(TEXT("Added locks"), Changes.Added.Num(), 2);
+	TestEqual(TEXT("Removed locks"), Changes.Removed.Num(), 3);
+	TestEqual(TEXT("Changed locks"), Changes.Changed.Num(), 1);
+	TestEqual(TEXT("Replaced locks"), Changes.Replaced.Num(), 1);
+	if (Changes.Changed.Num() == 1 && Changes.Replaced.Num() == 1)
+	{
+		TestTrue(TEXT("Changed lock"), Changes.Changed[0]->HasSameId(*Changes.Replaced[0]) && (Changes.Changed[0]->Owner != Changes.Replaced[0]->Owner));
+	}
+
+	// Unchanged locks are the very same objects as in the previous index
+	int32 NumReusedLocks = 0;
+	for (const FPlasticSourceControlLockRef& Lock : LocksIndex.GetLocks())
+	{
+		for (const FPlasticSourceControlLockRef& PreviousLock : PreviousLocksIndex.FindByItemId(Lock->ItemId))
+		{
+			NumReusedLocks += (Lock == PreviousLock) ? 1 : 0;
+		}
+	}
+	TestEqual(TEXT("Reused locks"), NumReusedLocks, Locks.Num() - 4);
+
+	// The same list again doesn't change anything
+	TArray<FPlasticSourceControlLock> SameLocks;
+	for (const FPlasticSourceControlLockRef& Lock : LocksIndex.GetLocks())
+	{
+		SameLocks.Add(*Lock);
+	}
+	const FPlasticSourceControlLocksIndex SameLocksIndex(LocksIndex, MoveTemp(SameLocks));
+	TestTrue(TEXT("No changes"), SameLocksIndex.GetChanges().IsEmpty());
+	TestTrue(TEXT("Same locks"), SameLocksIndex.GetLocks() == LocksIndex.GetLocks());
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlasticUnlockedLocksTest, "PlasticSCM.Locks.UnlockedLocks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+// Locks to unlock are batched by branches, and the cache is updated with the locks actually unlocked instead of listing them again
+bool FPlasticUnlockedLocksTest::RunTest(const FString& Parameters)
+{
+	const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(2000);
+	TArray<FPlasticSourceControlLock> Locks;
+	for (const FString& LockResult : PlasticSourceControlSyntheticOutputs::GenerateSmartLockList(Files))
+	{
+		Locks.Add(PlasticSourceControlParsers::ParseLockInfo(LockResult));
+	}
+	const FPlasticSourceControlLocksIndex LocksIndex(FPlasticSourceControlLocksIndex(), MoveTemp(Locks));
+	const TArray<FPlasticSourceControlLockRef>& AllLocks = LocksIndex.GetLocks();
+
+	const int32 MaxBatchSize = 7;
+	const TArray<TArray<FPlasticSourceControlLockRef>> Batches = PlasticSourceControlUtils::BatchLocksToUnlock(AllLocks, MaxBatchSize);
+	int32 NumBatchedLocks = 0;
+	bool bBatchesOnSameBranches = true;
+	bool bBatchesWithinSize = true;
+	for (const TArray<FPlasticSourceControlLockRef>& Batch : Batches)
+	{
+		NumBatchedLocks += Batch.Num();
+		bBatchesWithinSize &= (Batch.Num() > 0) && (Batch.Num() <= MaxBatchSize);
+		for (const FPlasticSourceControlLockRef& Lock : Batch)
+		{
+			bBatchesOnSameBranches &= (Lock->DestinationBranch == Batch[0]->DestinationBranch) && (Lock->Branch == Batch[0]->Branch);
+		}
+	}
+	TestEqual(TEXT("Batched locks"), NumBatchedLocks, AllLocks.Num());
+	TestTrue(TEXT("Batches within the maximum size"), bBatchesWithinSize);
+	TestTrue(TEXT("Batches on the same branches"), bBatchesOnSameBranches);
+
+	// Unlock one lock out of three, identified by copies as if they came from another list
+	TArray<FPlasticSourceControlLockRef> UnlockedLocks;
+	for (int32 LockIndex = 0; LockIndex < AllLocks.Num(); LockIndex += 3)
+	{
+		UnlockedLocks.Add(MakeShareable(new FPlasticSourceControlLock(*AllLocks[LockIndex])));
+	}
+	const FPlasticSourceControlLocksIndex RemainingLocksIndex(LocksIndex, UnlockedLocks);
+	TestTrue(TEXT("Previous serial"), RemainingLocksIndex.GetPreviousSerial() == LocksIndex.GetSerial());
+	TestEqual(TEXT("Remaining locks"), RemainingLocksIndex.GetLocks().Num(), AllLocks.Num() - UnlockedLocks.Num());
+	TestEqual(TEXT("Removed locks"), RemainingLocksIndex.GetChanges().Removed.Num(), UnlockedLocks.Num());
+	TestTrue(TEXT("Only removed locks"), RemainingLocksIndex.GetChanges().Added.Num() == 0 && RemainingLocksIndex.GetChanges().Changed.Num() == 0);
+	if (RemainingLocksIndex.GetChanges().Removed.Num() > 0)
+	{
+		// The removed locks are the objects of the previous index, so that the rows displaying them can be found
+		TestTrue(TEXT("Removed lock"), RemainingLocksIndex.GetChanges().Removed[0] == AllLocks[0]);
+	}
+	if (AllLocks.Num() > 1)
+	{
+		TestTrue(TEXT("Remaining lock"), RemainingLocksIndex.FindByItemId(AllLocks[1]->ItemId).Contains(AllLocks[1]));
+	}
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlasticLocksSummaryTest, "PlasticSCM.Locks.LocksSummary", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+// The summary updated incrementally with the changes is the same as the one computed from the whole list
+bool FPlasticLocksSummaryTest::RunTest(const FString& Parameters)
+{
+	auto SameCounts = [](const TMap<FString, FPlasticSourceControlLocksSummary::FCount>& InCounts, const TMap<FString, FPlasticSourceControlLocksSummary::FCount>& InExpectedCounts)
+	{
+		if (InCounts.Num() != InExpectedCounts.Num())
+			return false;
+		for (const TPair<FString, FPlasticSourceControlLocksSummary::FCount>& ExpectedCount : InExpectedCounts)
+		{
+			const FPlasticSourceControlLocksSummary::FCount* Count = InCounts.Find(ExpectedCount.Key);
+			if (!Count || (Count->Num != ExpectedCount.Value.Num) || (Count->NumRetained != ExpectedCount.Value.NumRetained))
+				return false;
+		}
+		return true;
+	};
+
+	const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(1000);
+	TArray<FPlasticSourceControlLock> Locks;
+	for (const FString& LockResult : PlasticSourceControlSyntheticOutputs::GenerateSmartLockList(Files))
+	{
+		Locks.Add(PlasticSourceControlParsers::ParseLockInfo(LockResult));
+	}
+	const FPlasticSourceControlLocksIndex PreviousLocksIndex(FPlasticSourceControlLocksIndex(), CopyTemp(Locks));
+
+	// Next list: the first lock released, the second one changing owner, and the third one retained
+	TArray<FPlasticSourceControlLock> NextLocks = Locks;
+	NextLocks.RemoveAt(0);
+	NextLocks[0].Owner = TEXT("someone.else@unity3d.com");
+	NextLocks[1].bIsLocked = false;
+	NextLocks[1].Status = TEXT("Retained");
+	TArray<FPlasticSourceControlLockRef> NextLockRefs;
+	for (const FPlasticSourceControlLock& Lock : NextLocks)
+	{
+		NextLockRefs.Add(MakeShareable(new FPlasticSourceControlLock(Lock)));
+	}
+
+	const FPlasticSourceControlLocksIndex LocksIndex(PreviousLocksIndex, MoveTemp(NextLocks));
+	const FPlasticSourceControlLocksIndex ExpectedLocksIndex(NextLockRefs);
+	const FPlasticSourceControlLocksSummary& Summary = LocksIndex.GetSummary();
+	const FPlasticSourceControlLocksSummary& ExpectedSummary = ExpectedLocksIndex.GetSummary();
+	TestEqual(TEXT("Total"), Summary.GetTotal().Num, ExpectedSummary.GetTotal().Num);
+	TestEqual(TEXT("Total retained"), Summary.GetTotal().NumRetained, ExpectedSummary.GetTotal().NumRetained);
+	TestTrue(TEXT("Counts by owner"), SameCounts(Summary.GetCountsByOwner(), ExpectedSummary.GetCountsByOwner()));
+	TestTrue(TEXT("Counts by branch"), SameCounts(Summary.GetCountsByBranch(), ExpectedSummary.GetCountsByBranch()));
+	TestTrue(TEXT("Counts by folder"), SameCounts(Summary.GetCountsByFolder(), ExpectedSummary.GetCountsByFolder()));
+	TestTrue(TEXT("Owner of the changed lock"), Summary.GetCountsByOwner().Contains(TEXT("someone.else@unity3d.com")));
+
+	int32 NumLocksByAge = 0;
+	for (const FPlasticSourceControlLocksSummary::FCount& Count : Summary.GetCountsByAge(FDateTime::Now()))
+	{
+		NumLocksByAge += Count.Num;
+	}
+	TestEqual(TEXT("Counts by age"), NumLocksByAge, Summary.GetTotal().Num);
+
+	const TArray<TPair<FString, FPlasticSourceControlLocksSummary::FCount>> LargestCounts = FPlasticSourceControlLocksSummary::GetLargestCounts(Summary.GetCountsByFolder(), 3);
+	TestTrue(TEXT("Largest counts"), (LargestCounts.Num() <= 3) && ((LargestCounts.Num() < 2) || (LargestCounts[0].Value.Num >= LargestCounts[1].Value.Num)));
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FLocksIndexBenchmark, "PlasticSCM.Benchmarks.LocksIndex", GetBenchmarkSizes)
+
+// Match the locks of a fileinfo pass over 5k files, among locks on one file out of ten
+bool FLocksIndexBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace PlasticSourceControlLocksIndexTests;
+
+	static const int32 NumFilesInPass = 5000;
+	const int32 NumFiles = FCString::Atoi(*Parameters) * 10;
+	const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(NumFiles);
+	const TArray<FPlasticSourceControlLockRef> Locks = MakeLocks(Files);
+	const int32 NumMatches = FMath::Min(NumFiles, NumFilesInPass);
+
+	double StartTime = FPlatformTime::Seconds();
+	int32 NumLinearMatches = 0;
+	for (int32 Index = 0; Index < NumMatches; Index++)
+	{
+		NumLinearMatches += FindLockForFileLinear(Locks, Files[Index]).IsValid() ? 1 : 0;
+	}
+	ReportThroughput(*this, TEXT("Linear scan"), NumMatches, 0, FPlatformTime::Seconds() - StartTime);
+
+	StartTime = FPlatformTime::Seconds();
+	const FPlasticSourceControlLocksIndex LocksIndex(Locks);
+	int32 NumIndexedMatches = 0;
+	for (int32 Index = 0; Index < NumMatches; Index++)
+	{
+		NumIndexedMatches += LocksIndex.FindByFilename(Files[Index]).IsValid() ? 1 : 0;
+	}
+	ReportThroughput(*this, TEXT("Index (including building it)"), NumMatches, 0, FPlatformTime::Seconds() - StartTime);
+
+	TestEqual(TEXT("Number of locks"), Locks.Num(), NumFiles / 10);
+	TestEqual(TEXT("Number of matches"), NumIndexedMatches, NumLinearMatches);
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+// Dates of changesets one hour apart with a mix of the timezones and fractional seconds emitted by cm
+static TArray<FString> GenerateDates(const int32 InNumDates)
+{
+	static const TCHAR* Timezones[] = { TEXT("+02:00"), TEXT("Z"), TEXT("-05:30"), TEXT(".123+01:00"), TEXT(".5Z") };
+
+	TArray<FString> Dates;
+	Dates.Reserve(InNumDates);
+	for (int32 Index = 0; Index < InNumDates; Index++)
+	{
+		const FDateTime Date = FDateTime(2024, 1, 1) + FTimespan::FromMinutes(Index * 7) + FTimespan::FromSeconds(Index % 60);
+		Dates.Add(Date.ToString(TEXT("%Y-%m-%dT%H:%M:%S")) + Timezones[Index % UE_ARRAY_COUNT(Timezones)]);
+	}
+	return Dates;
+}
+
+IMPLEMENT_PLASTIC_BENCHMARK(FParseDateBenchmark, "PlasticSCM.Benchmarks.ParseDate", GetBenchmarkSizes)
+
+// Compare the parser of the dates emitted by cm to the generic FDateTime::ParseIso8601()
+bool FParseDateBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<FDateTime> GenericDates;
+	BenchmarkParser<TArray<FString>>(*this, TEXT("FDateTime::ParseIso8601"), Parameters, GenerateDates,
+		[&GenericDates](TArray<FString>&& InDates)
+	{
+		GenericDates.SetNumUninitialized(InDates.Num());
+		for (int32 Index = 0; Index < InDates.Num(); Index++)
+		{
+			FDateTime::ParseIso8601(*InDates[Index], GenericDates[Index]);
+		}
+		return GenericDates.Num();
+	});
+
+	TArray<FDateTime> ParsedDates;
+	BenchmarkParser<TArray<FString>>(*this, TEXT("FPlasticDateParser"), Parameters, GenerateDates,
+		[&ParsedDates](TArray<FString>&& InDates)
+	{
+		ParsedDates.SetNumUninitialized(InDates.Num());
+		PlasticSourceControlParsers::FPlasticDateParser DateParser;
+		for (int32 Index = 0; Index < InDates.Num(); Index++)
+		{
+			DateParser.Parse(InDates[Index], ParsedDates[Index]);
+		}
+		return ParsedDates.Num();
+	});
+
+	TestTrue(TEXT("Same dates"), ParsedDates == GenericDates);
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlasticDateParserTest, "PlasticSCM.Parsers.DateParser", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FPlasticDateParserTest::RunTest(const FString& Parameters)
+{
+	// The dates emitted by cm, then dates deviating from their format that are handled by the generic parser, and invalid dates
+	const TArray<FString> Dates = {
+		TEXT("2024-04-03T14:59:31+02:00"), TEXT("2024-04-03T14:59:31-02:30"), TEXT("2024-04-03T12:59:31Z"), TEXT("2024-04-03T12:59:31"),
+		TEXT("2024-04-03T12:59:31.12Z"), TEXT("2024-04-03T12:59:31.123-01:00"), TEXT("2024-02-29T23:00:00+01:00"), TEXT("0001-01-01T00:00:00"),
+		TEXT("2024-04-03"), TEXT("2024-04-03T14:59:31+02"), TEXT("2024-04-03T14:59:31+0200"),
+		TEXT("2024-04-03T12:59:31.123456789Z"), TEXT(""), TEXT("2024-04-03T14:59:31+"), TEXT("2024-04-03T14:59:31."), TEXT("2024-04-03T24:00:00"), TEXT("2023-02-29T12:00:00"),
+		TEXT("2024-13-01T12:00:00"), TEXT("2024-04-03T14:60:31"), TEXT("2024-04-03T14:59:31+02:00 "), TEXT("2O24-04-03T14:59:31")
+	};
+
+	PlasticSourceControlParsers::FPlasticDateParser DateParser;
+	for (const FString& Date : Dates)
+	{
+		FDateTime GenericDate, ParsedDate;
+		const bool bGenericResult = FDateTime::ParseIso8601(*Date, GenericDate);
+		const bool bResult = DateParser.Parse(Date, ParsedDate);
+		TestTrue(FString::Printf(TEXT("Result of '%s'"), *Date), bResult == bGenericResult);
+		if (bGenericResult)
+		{
+			TestTrue(FString::Printf(TEXT("Date of '%s'"), *Date), ParsedDate == GenericDate);
+		}
+	}
+
+	// Fractional seconds finer than milliseconds, as documented for the dates emitted by cm, are kept to the tick
+	const FDateTime ExpectedDate = FDateTime(2024, 4, 3, 12, 59, 31);
+	const TArray<TPair<FString, FDateTime>> FineDates = {
+		{ TEXT("2024-04-03T12:59:31.1234567Z"), ExpectedDate + FTimespan(1234567) },
+		{ TEXT("2024-04-03T14:59:31.1234567+02:00"), ExpectedDate + FTimespan(1234567) },
+		{ TEXT("2024-04-03T12:59:31.0000001Z"), ExpectedDate + FTimespan(1) },
+		{ TEXT("2024-04-03T12:59:31.12345Z"), ExpectedDate + FTimespan(1234500) },
+		{ TEXT("2024-04-03T12:59:31.9999999-01:00"), ExpectedDate + FTimespan::FromHours(1) + FTimespan(9999999) }
+	};
+	for (const TPair<FString, FDateTime>& FineDate : FineDates)
+	{
+		FDateTime ParsedDate;
+		TestTrue(FString::Printf(TEXT("Result of '%s'"), *FineDate.Key), DateParser.Parse(FineDate.Key, ParsedDate));
+		TestEqual(FString::Printf(TEXT("Ticks of '%s'"), *FineDate.Key), ParsedDate.GetTicks(), FineDate.Value.GetTicks());
+	}
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParseFindFormatResultsTest, "PlasticSCM.Parsers.FindFormatResults", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FParseFindFormatResultsTest::RunTest(const FString& Parameters)
+{
+	// Multi-line comments with empty lines, and with lines starting with the separator, even with as many fields as a record
+	const TArray<FString> ChangesetsResults = {
+		TEXT("#_#56#_#2024-03-25T10:37:14+01:00#_#sebastien.rombauts@unity3d.com#_#/main#_#Fix the lighting"),
+		TEXT(""),
+		TEXT("#_# Rebuild the lighting"),
+		TEXT("#_#of#_#the#_#main#_#level"),
+		TEXT(""),
+		TEXT("#_#55#_#2024-03-25T10:21:40+01:00#_#sebastien.rombauts@unity3d.com#_#/main/task#_#a#_#b"),
+		TEXT("#_#54#_#2024-03-25T09:00:00+01:00#_#sebastien.rombauts@unity3d.com#_#/main#_#")
+	};
+	TArray<FPlasticSourceControlChangesetRef> Changesets;
+	TestTrue(TEXT("Parsed changesets"), PlasticSourceControlParsers::ParseChangesetsResults(ChangesetsResults, Changesets));
+	if (TestEqual(TEXT("Number of changesets"), Changesets.Num(), 3))
+	{
+		TestEqual(TEXT("Changeset id"), Changesets[0]->ChangesetId, 56);
+		TestEqual(TEXT("Branch"), Changesets[0]->Branch, FString(TEXT("/main")));
+		TestEqual(TEXT("Multi-line comment"), Changesets[0]->Comment, FString(TEXT("Fix the lighting\n\n#_# Rebuild the lighting\n#_#of#_#the#_#main#_#level\n")));
+		TestEqual(TEXT("Changeset id"), Changesets[1]->ChangesetId, 55);
+		TestEqual(TEXT("Comment with separators"), Changesets[1]->Comment, FString(TEXT("a#_#b")));
+		TestEqual(TEXT("Changeset id"), Changesets[2]->ChangesetId, 54);
+		TestTrue(TEXT("Empty comment"), Changesets[2]->Comment.IsEmpty());
+	}
+
+	const TArray<FString> BranchesResults = {
+		TEXT("#_#/main#_#2023-10-18T15:08:49+02:00#_#sebastien.rombauts@unity3d.com#_#UE5PlasticPluginDev#_#SRombautsU@cloud#_#main branch"),
+		TEXT(""),
+		TEXT("#_#/main/fake#_#not a date#_#owner#_#repository#_#server#_#comment"),
+		TEXT("#_#/main/ScalableLocks#_#2023-11-21T13:35:04+01:00#_#sebastien.rombauts@unity3d.com#_#UE5PlasticPluginDev#_#SRombautsU@cloud#_#")
+	};
+	TArray<FPlasticSourceControlBranchRef> Branches;
+	TestTrue(TEXT("Parsed branches"), PlasticSourceControlParsers::ParseBranchesResults(BranchesResults, Branches));
+	if (TestEqual(TEXT("Number of branches"), Branches.Num(), 2))
+	{
+		TestEqual(TEXT("Multi-line comment"), Branches[0]->Comment, FString(TEXT("main branch\n\n#_#/main/fake#_#not a date#_#owner#_#repository#_#server#_#comment")));
+		TestEqual(TEXT("Branch name"), Branches[1]->Name, FString(TEXT("/main/ScalableLocks")));
+		TestEqual(TEXT("Repository"), Branches[1]->Repository, FString(TEXT("UE5PlasticPluginDev@SRombautsU@cloud")));
+	}
+
+	// A line outside of any comment that isn't a record
+	AddExpectedError(TEXT("Malformed result"), EAutomationExpectedErrorFlags::Contains, 1);
+	TArray<FPlasticSourceControlChangesetRef> MalformedChangesets;
+	TestFalse(TEXT("Malformed changesets"), PlasticSourceControlParsers::ParseChangesetsResults({ TEXT("#_#56#_#2024-03-25") }, MalformedChangesets));
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+/**
+ * Fuzzing of the parsers of cm outputs: feed them with corrupted variants of realistic outputs and check that they never crash.
+ *
+ * The mutations are deterministic to make any failure reproducible; use "-PlasticFuzzSeed=<seed>" and "-PlasticFuzzIterations=<count>"
+ * on the command line to explore more inputs, for instance in a nightly run.
+ */
+namespace PlasticSourceControlParsersFuzzing
+{
+
+static const int32 DefaultNumIterations = 500;
+
+// Characters with a meaning for the parsers: field separators, XML markup and entities, RepSpec separators, etc.
+static const TCHAR SpecialChars[] = TEXT(";<>/&#\"'@:| \t\n");
+
+static TCHAR RandomChar(FRandomStream& InRandom)
+{
+	if (InRandom.RandRange(0, 3) > 0)
+	{
+		return SpecialChars[InRandom.RandRange(0, UE_ARRAY_COUNT(SpecialChars) - 2)];
+	}
+	return static_cast<TCHAR>(InRandom.RandRange(1, 0x7F));
+}
+
+/** Apply a few random mutations to a seed: truncation, deletion or duplication of a range, replacement or insertion of characters */
+static FString Mutate(const FString& InSeed, FRandomStream& InRandom)
+{
+	FString Input = InSeed;
+	const int32 NumMutations = InRandom.RandRange(1, 4);
+	for (int32 Mutation = 0; Mutation < NumMutations; Mutation++)
+	{
+		const int32 Position = InRandom.RandRange(0, Input.Len());
+		const int32 Count = InRandom.RandRange(1, FMath::Max(1, FMath::Min(64, Input.Len() - Position)));
+		switch (InRandom.RandRange(0, 4))
+		{
+		case 0:
+			Input.LeftInline(Position);
+			break;
+		case 1:
+			Input.RemoveAt(Position, FMath::Min(Count, Input.Len() - Position));
+			break;
+		case 2:
+			Input.InsertAt(Position, Input.Mid(Position, Count));
+			break;
+		case 3:
+			if (Position < Input.Len())
+			{
+				Input[Position] = RandomChar(InRandom);
+			}
+			break;
+		default:
+			Input.InsertAt(Position, RandomChar(InRandom));
+			break;
+		}
+	}
+	return Input;
+}
+
+static TArray<FString> SplitLines(const FString& InInput)
+{
+	TArray<FString> Lines;
+	InInput.ParseIntoArrayLines(Lines, true);
+	return Lines;
+}
+
+/** Run a parser on mutations of each of its seeds (the seeds being the outputs of cm with lines joined by new lines) */
+static void Fuzz(FAutomationTestBase& InTest, const TCHAR* InParserName, const TArray<FString>& InSeeds, TFunctionRef<void(FString&&)> InParser)
+{
+	int32 Seed = 0;
+	FParse::Value(FCommandLine::Get(), TEXT("PlasticFuzzSeed="), Seed);
+	int32 NumIterations = DefaultNumIterations;
+	FParse::Value(FCommandLine::Get(), TEXT("PlasticFuzzIterations="), NumIterations);
+
+	FRandomStream Random(Seed);
+	for (const FString& SeedInput : InSeeds)
+	{
+		InParser(CopyTemp(SeedInput));
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			InParser(Mutate(SeedInput, Random));
+		}
+	}
+	InTest.AddInfo(FString::Printf(TEXT("%s: %d inputs (seed %d)"), InParserName, InSeeds.Num() * (NumIterations + 1), Seed));
+}
+
+static FString JoinLines(const TArray<FString>& InLines)
+{
+	return FString::Join(InLines, TEXT("\n"));
+}
+
+} // namespace PlasticSourceControlParsersFuzzing
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParsersFuzzTest, "PlasticSCM.Fuzz.Parsers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FParsersFuzzTest::RunTest(const FString& Parameters)
+{
+	using namespace PlasticSourceControlParsersFuzzing;
+
+	// Most of the corrupted XML inputs are rejected by the parsers, logging an error that is expected here
+	AddExpectedError(TEXT("XML parse error"), EAutomationExpectedErrorFlags::Contains, 0);
+
+	// Keep the metadata of the fuzzed changesets out of the table shared with the editor session
+	const FScopedChangesetMetadataTable ScopedMetadataTable;
+
+	const TArray<FString> Files = PlasticSourceControlSyntheticOutputs::GenerateFilenames(8);
+	const FString WorkspaceRoot = PlasticSourceControlSyntheticOutputs::WorkspaceRoot;
+
+	Fuzz(*this, TEXT("ParseProfileInfo"), { TEXT("localhost:8087|sebastien.rombauts\nlocal|sebastien.rombauts@unity3d.com\nSRombautsU@cloud|sebastien.rombauts@unity3d.com") },
+		[](FString&& InInput) { TArray<FString> Results = SplitLines(InInput); PlasticSourceControlParsers::ParseProfileInfo(Results); });
+
+	Fuzz(*this, TEXT("ParseRepository"), { TEXT("My Project@SRombautsU@unity\nunreal-plugin@SRombautsU@unity") },
+		[](FString&& InInput) { TArray<FString> Results = SplitLines(InInput); PlasticSourceControlParsers::ParseRepository(Results); });
+
+	Fuzz(*this, TEXT("ParseWorkspaceInfo"), {
+			TEXT("Branch /main@UE5PlasticPluginDev@localhost:8087"),
+			TEXT("Branch /main@rep:UE5OpenWorldPerfTest@repserver:test@cloud"),
+			TEXT("Changeset 1234@UE5PlasticPluginDev@test@cloud"),
+			TEXT("Label 1.10.0@UE5PlasticPluginDev@test@cloud")
+		},
+		[](FString&& InInput)
+		{
+			TArray<FString> Results = SplitLines(InInput);
+			FString WorkspaceSelector, BranchName, RepositoryName, ServerUrl;
+			PlasticSourceControlParsers::ParseWorkspaceInfo(Results, WorkspaceSelector, BranchName, RepositoryName, ServerUrl);
+		});
+
+	Fuzz(*this, TEXT("GetChangesetFromWorkspaceStatus"), { TEXT("STATUS;41;UEPlasticPluginDev;localhost:8087\nSTATUS;41;UEPlasticPluginDev;test@cloud") },
+		[](FString&& InInput) { int32 Changeset; PlasticSourceControlParsers::GetChangesetFromWorkspaceStatus(SplitLines(InInput), Changeset); });
+
+	Fuzz(*this, TEXT("ParseDirectoryStatusResult"), { JoinLines(PlasticSourceControlSyntheticOutputs::GenerateStatus(Files)) },
+		[&WorkspaceRoot](FString&& InInput)
+		{
+			TArray<FPlasticSourceControlState> States;
+			PlasticSourceControlParsers::ParseDirectoryStatusResult(WorkspaceRoot, SplitLines(InInput), States);
+		});
+
+	Fuzz(*this, TEXT("ParseFileStatusResult"), { JoinLines(PlasticSourceControlSyntheticOutputs::GenerateStatus(Files)) },
+		[&Files](FString&& InInput)
+		{
+			TArray<FPlasticSourceControlState> States;
+			PlasticSourceControlParsers::ParseFileStatusResult(CopyTemp(Files), SplitLines(InInput), States);
+		});
+
+	TArray<FPlasticSourceControlLockRef> Locks;
+	for (const FString& LockResult : PlasticSourceControlSyntheticOutputs::GenerateLockList(Files))
+	{
+		Locks.Add(MakeShareable(new FPlasticSourceControlLock(PlasticSourceControlParsers::ParseLockInfo(LockResult))));
+	}
+	const FPlasticSourceControlLocksIndex LocksIndex(Locks);
+	Fuzz(*this, TEXT("ParseFileinfoResults"), { JoinLines(PlasticSourceControlSyntheticOutputs::GenerateFileinfo(Files)) },
+		[&Files, &LocksIndex](FString&& InInput)
+		{
+			const TArray<FString> Results = SplitLines(InInput);
+			// The fileinfo command gives exactly one result per file: keep the number of states in sync with the corrupted results
+			TArray<FPlasticSourceControlState> States;
+			for (int32 Index = 0; Index < Results.Num(); Index++)
+			{
+				States.Add(FPlasticSourceControlState(CopyTemp(Files[Index % Files.Num()])));
+			}
+			PlasticSourceControlParsers::ParseFileinfoResults(Results, LocksIndex, States);
+		});
+
+	Fuzz(*this, TEXT("ParseLockInfo"), PlasticSourceControlSyntheticOutputs::GenerateLockList(Files),
+		[](FString&& InInput) { PlasticSourceControlParsers::ParseLockInfo(InInput); });
+
+	Fuzz(*this, TEXT("FPlasticMergeConflictParser"), { TEXT("FILE_CONFLICT /Content/FirstPersonBP/Blueprints/FirstPersonProjectile.uasset 1 4 6 903") },
+		[](FString&& InInput) { PlasticSourceControlParsers::FPlasticMergeConflictParser MergeConflict(InInput); });
+
+	Fuzz(*this, TEXT("ParseUpdateResults"), { TEXT("STAGE Plastic is updating your workspace. Wait a moment, please...\nAD c:\\Workspace\\UE5PlasticPluginDev\\Content\\LevelPrototyping\\Materials\\MI_Solid_Red.uasset\nCH c:\\Workspace\\UE5PlasticPluginDev\\Config\\DefaultEditor.ini") },
+		[](FString&& InInput) { TArray<FString> UpdatedFiles; PlasticSourceControlParsers::ParseUpdateResults(SplitLines(InInput), UpdatedFiles); });
+
+	Fuzz(*this, TEXT("ParseUpdateResults (XML)"), { TEXT("<?xml version=\"1.0\" encoding=\"utf-8\" ?>\n<UpdatedItems>\n  <List>\n    <UpdatedItem>\n      <Path>c:\\Workspace\\UE5PlasticPluginDev\\Content\\NewFolder\\BP_CheckedOut.uasset</Path>\n      <User>sebastien.rombauts@unity3d.com</User>\n      <Changeset>94</Changeset>\n      <Date>2022-10-27T11:58:02+02:00</Date>\n    </UpdatedItem>\n  </List>\n</UpdatedItems>") },
+		[](FString&& InInput) { TArray<FString> UpdatedFiles; PlasticSourceControlParsers::ParseUpdateResults(MoveTemp(InInput), UpdatedFiles); });
+
+	Fuzz(*this, TEXT("ParseCheckInResults"), { TEXT("Created changeset cs:8@br:/main@MyProject@SRombauts@cloud (mount:'/')") },
+		[](FString&& InInput) { PlasticSourceControlParsers::ParseCheckInResults(SplitLines(InInput)); });
+
+	Fuzz(*this, TEXT("ParseHistoryResults"), { PlasticSourceControlSyntheticOutputs::GenerateHistoryXml({ Files[0], Files[1] }, 3) },
+		[&Files](FString&& InInput)
+		{
+			TArray<FPlasticSourceControlState> States = PlasticSourceControlParsersBenchmarks::MakeStates(Files);
+			PlasticSourceControlParsers::ParseHistoryResults(true, 2, MoveTemp(InInput), States);
+		});
+
+	Fuzz(*this, TEXT("ParseChangesetsResults"), { PlasticSourceControlSyntheticOutputs::GenerateChangesetsXml(3) },
+		[](FString&& InInput) { TArray<FPlasticSourceControlChangesetRef> Changesets; PlasticSourceControlParsers::ParseChangesetsResults(MoveTemp(InInput), Changesets); });
+
+	Fuzz(*this, TEXT("ParseLogResults"), { TEXT("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<LogList>\n  <Changeset>\n    <ObjId>2674</ObjId>\n    <ChangesetId>73</ChangesetId>\n    <Branch>/main/test</Branch>\n    <Comment>private files and folders</Comment>\n    <Owner>sebastien.rombauts@unity3d.com</Owner>\n    <GUID>cd803bd1-7d59-4573-b9de-1a4e684d573a</GUID>\n    <Changes>\n      <Item>\n        <Branch>/main/test</Branch>\n        <RevNo>72</RevNo>\n        <Owner>sebastien.rombauts@unity3d.com</Owner>\n        <RevId>2861</RevId>\n        <ParentRevId>-1</ParentRevId>\n        <SrcCmPath>/Private/Private.md</SrcCmPath>\n        <SrcParentItemId>2868</SrcParentItemId>\n        <DstCmPath>/Private/Moved.md</DstCmPath>\n        <DstParentItemId>2868</DstParentItemId>\n        <Date>2024-04-03T14:59:31+02:00</Date>\n        <Type>Moved</Type>\n      </Item>\n    </Changes>\n    <Date>2024-04-03T14:59:31+02:00</Date>\n  </Changeset>\n</LogList>") },
+		[](FString&& InInput)
+		{
+			const FPlasticSourceControlChangesetRef Changeset = MakeShareable(new FPlasticSourceControlChangeset());
+			Changeset->ChangesetId = 73;
+			TArray<FPlasticSourceControlStateRef> ChangesetFiles;
+			PlasticSourceControlParsers::ParseLogResults(MoveTemp(InInput), Changeset, ChangesetFiles);
+		});
+
+	Fuzz(*this, TEXT("ParseChangesetsResults (format)"), { JoinLines(PlasticSourceControlSyntheticOutputs::GenerateChangesetsFormat(3)) },
+		[](FString&& InInput) { TArray<FPlasticSourceControlChangesetRef> Changesets; PlasticSourceControlParsers::ParseChangesetsResults(SplitLines(InInput), Changesets); });
+
+	Fuzz(*this, TEXT("ParseBranchesResults (format)"), { JoinLines(PlasticSourceControlSyntheticOutputs::GenerateBranchesFormat(3)) },
+		[](FString&& InInput) { TArray<FPlasticSourceControlBranchRef> Branches; PlasticSourceControlParsers::ParseBranchesResults(SplitLines(InInput), Branches); });
+
+	Fuzz(*this, TEXT("ParseBranchesResults"), { PlasticSourceControlSyntheticOutputs::GenerateBranchesXml(3) },
+		[](FString&& InInput) { TArray<FPlasticSourceControlBranchRef> Branches; PlasticSourceControlParsers::ParseBranchesResults(MoveTemp(InInput), Branches); });
+
+	Fuzz(*this, TEXT("ParseMergeResults"), { TEXT("<Merge>\n  <Added />\n  <Deleted />\n  <Changed>\n    <MergeItem>\n      <ItemType>File</ItemType>\n      <Path>/Content/ThirdPerson/Blueprints/BP_Cube.uasset</Path>\n      <Size>19730</Size>\n      <User>sebastien.rombauts@unity3d.com</User>\n      <Date>2023-11-21T13:35:04+01:00</Date>\n    </MergeItem>\n  </Changed>\n  <Moved />\n  <PermissionsChanged />\n  <Warnings />\n  <DirConflicts />\n  <FileConflicts />\n</Merge>") },
+		[](FString&& InInput) { TArray<FString> MergedFiles; PlasticSourceControlParsers::ParseMergeResults(InInput, MergedFiles); });
+
+#if ENGINE_MAJOR_VERSION == 5
+	Fuzz(*this, TEXT("ParseChangelistsResults"), { TEXT("<StatusOutput>\n  <WkConfigType>Branch</WkConfigType>\n  <WkConfigName>/main@rep:UEPlasticPluginDev@repserver:test@cloud</WkConfigName>\n  <Changelists>\n    <Changelist>\n      <Name>Default</Name>\n      <Description>Default Unity Version Control changelist</Description>\n      <Changes>\n        <Change>\n          <Type>MV</Type>\n          <TypeVerbose>Moved</TypeVerbose>\n          <Path>Content/Renamed.uasset</Path>\n          <OldPath>Content/Original.uasset</OldPath>\n          <Size>583</Size>\n          <LastModified>2022-06-07T12:28:32+02:00</LastModified>\n        </Change>\n      </Changes>\n    </Changelist>\n  </Changelists>\n</StatusOutput>") },
+		[](FString&& InInput)
+		{
+			TArray<FPlasticSourceControlChangelistState> ChangelistsStates;
+			TArray<TArray<FPlasticSourceControlState>> CLFilesStates;
+			PlasticSourceControlParsers::ParseChangelistsResults(MoveTemp(InInput), ChangelistsStates, CLFilesStates);
+		});
+
+	const FString ShelveDiff = TEXT("C \"Content\\NewFolder\\BP_CheckedOut.uasset\"\nA \"Content\\NewFolder\\BP_ControlledUnchanged.uasset\"\nD \"Content\\NewFolder\\BP_Changed.uasset\"\nM \"Content\\NewFolder\\BP_ControlledUnchanged.uasset\" \"Content\\NewFolder\\BP_Renamed.uasset\"");
+	Fuzz(*this, TEXT("ParseShelveDiffResult"), { ShelveDiff },
+		[&WorkspaceRoot](FString&& InInput)
+		{
+			FPlasticSourceControlChangelistState ChangelistState(FPlasticSourceControlChangelist::DefaultChangelist);
+			PlasticSourceControlParsers::ParseShelveDiffResult(WorkspaceRoot, SplitLines(InInput), ChangelistState);
+		});
+	Fuzz(*this, TEXT("ParseShelveDiffResults"), { ShelveDiff },
+		[&WorkspaceRoot](FString&& InInput)
+		{
+			TArray<FPlasticSourceControlRevision> BaseRevisions;
+			PlasticSourceControlParsers::ParseShelveDiffResults(WorkspaceRoot, SplitLines(InInput), BaseRevisions);
+		});
+
+	const FString Shelves = TEXT("<?xml version=\"1.0\" encoding=\"utf-8\" ?>\n<PLASTICQUERY>\n  <SHELVE>\n    <ID>1376</ID>\n    <SHELVEID>9</SHELVEID>\n    <COMMENT>ChangelistDefault: test by Sebastien</COMMENT>\n    <DATE>2022-06-30T16:39:55+02:00</DATE>\n    <OWNER>sebastien.rombauts@unity3d.com</OWNER>\n    <REPOSITORY>UE5PlasticPluginDev</REPOSITORY>\n    <REPNAME>UE5PlasticPluginDev</REPNAME>\n    <REPSERVER>test@cloud</REPSERVER>\n    <PARENT>45</PARENT>\n    <GUID>8fbefbcc-81a7-4b81-9b99-b51f4873d09f</GUID>\n  </SHELVE>\n</PLASTICQUERY>");
+	Fuzz(*this, TEXT("ParseShelvesResults"), { Shelves },
+		[](FString&& InInput)
+		{
+			TArray<FPlasticSourceControlChangelistState> ChangelistsStates;
+			ChangelistsStates.Add(FPlasticSourceControlChangelistState(FPlasticSourceControlChangelist::DefaultChangelist));
+			PlasticSourceControlParsers::ParseShelvesResults(InInput, ChangelistsStates);
+		});
+	Fuzz(*this, TEXT("ParseShelvesResult"), { Shelves },
+		[](FString&& InInput)
+		{
+			FString Comment, Owner;
+			FDateTime Date;
+			PlasticSourceControlParsers::ParseShelvesResult(InInput, Comment, Date, Owner);
+		});
+#endif
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
+#endif
@@ -29,10 +29,34 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control", meta = (ClampMin = 0))
 	int32 LimitNumberOfRevisionsInHistory = 50;
 
+	/** Number of revisions loaded at first in the history of a selection of several files, the next ones being loaded on demand, up to LimitNumberOfRevisionsInHistory (default to 10) */
+	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control", meta = (ClampMin = 1))
+	int32 HistoryPageSize = 10;
+
+	/** Number of changesets loaded at first in the "Changesets" window, the next ones being loaded on demand when scrolling down the list (default to 1000) */
+	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control", meta = (ClampMin = 1))
+	int32 ChangesetsPageSize = 1000;
+
+	/** Read the XML results of cm commands directly from the output of the shell instead of writing them to temporary files and reading them back (disabled by default) */
+	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control")
+	bool bReadXmlResultsFromShellOutput = false;
+
 	/** Set an expiration time in minutes for the cache of SmartLocks, after which they need to be retrieved again from the server (default to 5 min) */
 	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control", meta = (ClampMin = 1))
 	double LocksCacheExpirationDelayMinutes = 5.0;
 
+	/** Once the cache of SmartLocks has expired, keep using it while it is refreshed in the background, up to this maximum age in minutes after which operations wait for the locks to be retrieved again (default to 15 min) */
+	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control", meta = (ClampMin = 1))
+	double LocksCacheMaxStalenessMinutes = 15.0;
+
+	/** If a non-null value is set, limit the number of file states kept in memory: the least recently used files that are controlled, unchanged and unlocked are evicted to a compact form, and restored on demand (default to 100000) */
+	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control", meta = (ClampMin = 0))
+	int32 StateCacheMaxEntries = 100000;
+
+	/** If a non-null value is set, limit the number of history revisions kept in memory for the files in the cache, dropping the least recently used histories first (default to 10000) */
+	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control", meta = (ClampMin = 0))
+	int32 StateCacheMaxHistoryRevisions = 10000;
+
 	/** Show the repository where the branch is created (hidden by default) */
 	UPROPERTY(config, EditAnywhere, Category = "Unity Version Control|View Branches window")
 	bool bShowBranchRepositoryColumn = false;
@@ -35,6 +35,12 @@
 
 static FName ProviderName("Plastic SCM");
 
+/** Time budget for processing completed commands in Tick(), to avoid hitching the Editor when a burst of commands completes in the same frame */
+static const double TickTimeBudgetSeconds = 0.005;
+
+/** Interval between two checks of the memory budget of the state cache, since it requires a full scan of the cache */
+static const double StateCacheEvictionIntervalSeconds = 10.0;
+
 FPlasticSourceControlProvider::FPlasticSourceControlProvider()
 {
 	PlasticSourceControlSettings.LoadSettings();
@@ -162,6 +168,11 @@ void FPlasticSourceControlProvider::Close()
 {
 	// clear the cache
 	StateCache.Empty();
+	EvictedStates.Empty();
+	FilesLoadingHistory.Empty();
+	FPlasticSourceControlChangesetMetadataTable::Get().Reset();
+	// wait for the background refresh of the locks, that uses the 'cm shell', and clear their cache
+	PlasticSourceControlUtils::ResetLocksCache();
 	// terminate the background 'cm shell' process and associated pipes
 	PlasticSourceControlShell::Terminate();
 	// Remove all extensions to the "Source Control" menu in the Editor Toolbar
@@ -181,17 +192,42 @@ TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe> FPlasticSourceContro
 	if (State != NULL)
 	{
 		// found cached item
+		(*State)->LastAccess = FPlatformAtomics::InterlockedIncrement(&StateCacheAccessCounter);
 		return (*State);
 	}
+	else if (EvictedStates.Num() > 0 && EvictedStates.Contains(InFilename))
+	{
+		// restore the state of a file evicted from the cache to enforce its memory budget, as it was before its eviction
+		FEvictedState EvictedState;
+		EvictedStates.RemoveAndCopyValue(InFilename, EvictedState);
+		TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe> RestoredState = MakeShareable(new FPlasticSourceControlState(FString(InFilename), EWorkspaceState::Controlled));
+		RestoredState->RepSpec = MoveTemp(EvictedState.RepSpec);
+		RestoredState->DepotRevisionChangeset = EvictedState.DepotRevisionChangeset;
+		RestoredState->LocalRevisionChangeset = EvictedState.LocalRevisionChangeset;
+		RestoredState->TimeStamp = EvictedState.TimeStamp;
+		RestoredState->LastAccess = FPlatformAtomics::InterlockedIncrement(&StateCacheAccessCounter);
+		StateCache.Add(InFilename, RestoredState);
+		return RestoredState;
+	}
 	else
 	{
 		// cache an unknown state for this item
 		TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe> NewState = MakeShareable(new FPlasticSourceControlState(FString(InFilename)));
+		NewState->LastAccess = FPlatformAtomics::InterlockedIncrement(&StateCacheAccessCounter);
 		StateCache.Add(InFilename, NewState);
 		return NewState;
 	}
 }
 
+TSharedPtr<FPlasticSourceControlState, ESPMode::ThreadSafe> FPlasticSourceControlProvider::FindStateInternal(const FString& InFilename) const
+{
+	if (const TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>* State = StateCache.Find(InFilename))
+	{
+		return *State;
+	}
+	return nullptr;
+}
+
 #if ENGINE_MAJOR_VERSION == 5
 TSharedRef<FPlasticSourceControlChangelistState, ESPMode::ThreadSafe> FPlasticSourceControlProvider::GetStateInternal(const FPlasticSourceControlChangelist& InChangelist)
 {
@@ -358,6 +394,7 @@ ECommandResult::Type FPlasticSourceControlProvider::GetState(const TArray<FStrin
 		Execute(ISourceControlOperation::Create<FUpdateStatus>(), AbsoluteFiles);
 	}
 
+	// Note: the files evicted from the cache to enforce its memory budget are transparently restored by GetStateInternal()
 	for (const FString& AbsoluteFile : AbsoluteFiles)
 	{
 		OutState.Add(GetStateInternal(AbsoluteFile));
@@ -430,6 +467,32 @@ bool FPlasticSourceControlProvider::RemoveFileFromCache(const FString& Filename)
 	return StateCache.Remove(Filename) > 0;
 }
 
+void FPlasticSourceControlProvider::LoadMoreHistory(const FPlasticSourceControlState& InState)
+{
+	// Note: the Editor can query the history from any thread, but commands can only be issued from the Game Thread
+	if (!IsInGameThread() || InState.bHistoryComplete || (InState.HistoryLimit <= 0) || FilesLoadingHistory.Contains(InState.LocalFilename))
+	{
+		return;
+	}
+
+	// Double the range of the history loaded so far, up to the full history set in the Project Settings (cm history has no offset)
+	TSharedRef<FPlasticGetHistory, ESPMode::ThreadSafe> GetHistoryOperation = ISourceControlOperation::Create<FPlasticGetHistory>();
+	const int32 MaxRevisions = GetDefault<UPlasticSourceControlProjectSettings>()->LimitNumberOfRevisionsInHistory;
+	const int32 HistoryLimit = InState.HistoryLimit * 2;
+	GetHistoryOperation->HistoryLimit = ((MaxRevisions > 0) && (HistoryLimit >= MaxRevisions)) ? INDEX_NONE : HistoryLimit;
+
+	UE_LOG(LogSourceControl, Verbose, TEXT("LoadMoreHistory(%s): %d revisions loaded so far, loading up to %d"), *InState.LocalFilename, InState.History.Num(), (GetHistoryOperation->HistoryLimit > 0) ? GetHistoryOperation->HistoryLimit : MaxRevisions);
+
+	const FString Filename = InState.LocalFilename;
+	FilesLoadingHistory.Add(Filename);
+	Execute(GetHistoryOperation, TArray<FString>({Filename}), EConcurrency::Asynchronous, FSourceControlOperationComplete::CreateLambda(
+		[this, Filename](const FSourceControlOperationRef& InOperation, ECommandResult::Type InResult)
+		{
+			FilesLoadingHistory.Remove(Filename);
+		}
+	));
+}
+
 FDelegateHandle FPlasticSourceControlProvider::RegisterSourceControlStateChanged_Handle(const FSourceControlStateChanged::FDelegate& SourceControlStateChanged)
 {
 	return OnSourceControlStateChanged.Add(SourceControlStateChanged);
@@ -693,58 +756,216 @@ void FPlasticSourceControlProvider::Tick()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPlasticSourceControlProvider::Tick);
 
+	const double TickStartTimestamp = FPlatformTime::Seconds();
+
 	bool bStatesUpdated = false;
-	for (int32 CommandIndex = 0; CommandIndex < CommandQueue.Num(); ++CommandIndex)
+	int32 CommandIndex = 0;
+	while (CommandIndex < CommandQueue.Num())
 	{
 		FPlasticSourceControlCommand& Command = *CommandQueue[CommandIndex];
-		if (Command.bExecuteProcessed)
+		if (!Command.bExecuteProcessed)
 		{
-			// Remove command from the queue
-			CommandQueue.RemoveAt(CommandIndex);
+			++CommandIndex;
+			continue;
+		}
 
-			// Update workspace status and connection state on Connect and UpdateStatus operations
-			UpdateWorkspaceStatus(Command);
+		// Remove command from the queue *before* running any callback,
+		// since the completion delegate can issue new commands, or even run a synchronous one that will Tick() recursively.
+		// Those can only append or remove entries, so the index is re-checked against the queue size on each iteration.
+		CommandQueue.RemoveAt(CommandIndex);
 
-			// let command update the states of any files
-			bStatesUpdated |= Command.Worker->UpdateStates();
+		bStatesUpdated |= ProcessCompletedCommand(Command);
 
-			// dump any messages to output log
-			OutputCommandMessages(Command);
+		// process as many completed commands as possible within the time budget of the frame, the remaining ones will be processed on next Tick()
+		if (FPlatformTime::Seconds() - TickStartTimestamp > TickTimeBudgetSeconds)
+		{
+			break;
+		}
+	}
 
-			if (Command.Files.Num() > 1)
-			{
-				UE_LOG(LogSourceControl, Log, TEXT("%s of %d items processed in %.3lfs"), *Command.Operation->GetName().ToString(), Command.Files.Num(), (FPlatformTime::Seconds() - Command.StartTimestamp));
-			}
-			else if (Command.Files.Num() == 1)
-			{
-				UE_LOG(LogSourceControl, Log, TEXT("%s of %s processed in %.3lfs"), *Command.Operation->GetName().ToString(), *Command.Files[0], (FPlatformTime::Seconds() - Command.StartTimestamp));
-			}
-			else
-			{
-				UE_LOG(LogSourceControl, Log, TEXT("%s processed in %.3lfs"), *Command.Operation->GetName().ToString(), (FPlatformTime::Seconds() - Command.StartTimestamp));
-			}
+	// apply the locks changed on the working branch, fetched by any of the commands, to the states of the files they are on
+	bStatesUpdated |= PlasticSourceControlUtils::UpdateCachedLocks();
 
-			// run the completion delegate callback if we have one bound
-			Command.ReturnResults();
+	// fold all the states updates of the commands completed during this frame into a single broadcast
+	if (bStatesUpdated)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPlasticSourceControlProvider::Tick::BroadcastStateUpdate);
+		OnSourceControlStateChanged.Broadcast();
+	}
 
-			// commands that are left in the array during a tick need to be deleted
-			if (Command.bAutoDelete)
-			{
-				// Only delete commands that are not running 'synchronously'
-				delete &Command;
-			}
+	// Refresh the locks in the background before a status has to wait for them
+	PlasticSourceControlUtils::TickLocksCache(*this, CommandQueue.Num() == 0);
+
+	// Periodically enforce the memory budget of the state cache, only when no command is running since workers can access the cache in the background
+	if ((CommandQueue.Num() == 0) && (FPlatformTime::Seconds() - LastStateCacheEvictionTimestamp > StateCacheEvictionIntervalSeconds))
+	{
+		LastStateCacheEvictionTimestamp = FPlatformTime::Seconds();
+		EvictStateCache();
+	}
+}
+
+/** A state can be evicted only if it is not in use, and if FEvictedState records all its information, so that it can be restored as it was */
+static bool CanEvictState(const TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>& InState)
+{
+	// Still referenced outside of the cache (eg. by the Editor or by a command)
+	if (InState.GetSharedReferenceCount() > 1)
+	{
+		return false;
+	}
+
+	// Never evict pending changes, nor locked or retained files, nor files in a changelist
+	if ((InState->WorkspaceState != EWorkspaceState::Controlled) || InState->IsLocked() || !InState->RetainedBy.IsEmpty())
+	{
+		return false;
+	}
+	// Nor files modified in another branch, or moved, since their head info and original name are not recorded
+	if (!InState->HeadBranch.IsEmpty() || !InState->MovedFrom.IsEmpty())
+	{
+		return false;
+	}
+#if ENGINE_MAJOR_VERSION == 5
+	if (InState->Changelist.IsInitialized())
+	{
+		return false;
+	}
+#endif
+
+	// Revisions still referenced (eg. by the History window) point back to their state
+	for (const auto& Revision : InState->History)
+	{
+		if (Revision.GetSharedReferenceCount() > 1)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FPlasticSourceControlProvider::EvictStateCache()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPlasticSourceControlProvider::EvictStateCache);
+
+	const UPlasticSourceControlProjectSettings* Settings = GetDefault<UPlasticSourceControlProjectSettings>();
+	const int32 MaxEntries = Settings->StateCacheMaxEntries;
+	const int32 MaxHistoryRevisions = Settings->StateCacheMaxHistoryRevisions;
+
+	int32 NumHistoryRevisions = 0;
+	if (MaxHistoryRevisions > 0)
+	{
+		for (const auto& CacheItem : StateCache)
+		{
+			NumHistoryRevisions += CacheItem.Value->History.Num();
+		}
+	}
+
+	const bool bOverEntriesBudget = (MaxEntries > 0) && (StateCache.Num() > MaxEntries);
+	const bool bOverHistoryBudget = (MaxHistoryRevisions > 0) && (NumHistoryRevisions > MaxHistoryRevisions);
+	if (!bOverEntriesBudget && !bOverHistoryBudget)
+	{
+		return;
+	}
 
-			// only do one command per tick loop, as we don't want concurrent modification
-			// of the command queue (which can happen in the completion delegate)
+	// Evict down to 90% of the budget, so that it is not exceeded again right away
+	const int32 NumStatesToEvict = bOverEntriesBudget ? StateCache.Num() - (MaxEntries / 10) * 9 : 0;
+	const int32 NumRevisionsToEvict = bOverHistoryBudget ? NumHistoryRevisions - (MaxHistoryRevisions / 10) * 9 : 0;
+
+	TArray<TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>> EvictableStates;
+	for (const auto& CacheItem : StateCache)
+	{
+		if (CanEvictState(CacheItem.Value))
+		{
+			EvictableStates.Add(CacheItem.Value);
+		}
+	}
+
+	// Least recently used first
+	EvictableStates.Sort([](const TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>& InLhs, const TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>& InRhs)
+	{
+		return InLhs->LastAccess < InRhs->LastAccess;
+	});
+
+	int32 NumEvictedStates = 0;
+	int32 NumEvictedRevisions = 0;
+	for (const TSharedRef<FPlasticSourceControlState, ESPMode::ThreadSafe>& State : EvictableStates)
+	{
+		if (NumEvictedStates < NumStatesToEvict)
+		{
+			NumEvictedRevisions += State->History.Num();
+			EvictedStates.Add(State->LocalFilename, { MoveTemp(State->RepSpec), State->DepotRevisionChangeset, State->LocalRevisionChangeset, State->TimeStamp, ++EvictionCounter });
+			StateCache.Remove(State->LocalFilename);
+			NumEvictedStates++;
+		}
+		else if (NumEvictedRevisions < NumRevisionsToEvict)
+		{
+			NumEvictedRevisions += State->History.Num();
+			State->History.Empty();
+			State->HistoryLimit = 0;
+			State->bHistoryComplete = false;
+		}
+		else
+		{
 			break;
 		}
 	}
 
-	if (bStatesUpdated)
+	// The evicted states are compact but also bounded: forget the oldest ones, that will have their status queried again like any other file
+	int32 NumForgottenStates = 0;
+	if ((MaxEntries > 0) && (EvictedStates.Num() > MaxEntries))
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FPlasticSourceControlProvider::Tick::BroadcastStateUpdate);
-		OnSourceControlStateChanged.Broadcast();
+		EvictedStates.ValueSort([](const FEvictedState& InLhs, const FEvictedState& InRhs)
+		{
+			return InLhs.EvictionOrder < InRhs.EvictionOrder;
+		});
+		NumForgottenStates = EvictedStates.Num() - (MaxEntries / 10) * 9;
+		int32 Index = 0;
+		for (auto It = EvictedStates.CreateIterator(); It && (Index < NumForgottenStates); ++It, ++Index)
+		{
+			It.RemoveCurrent();
+		}
+		EvictedStates.Compact();
+	}
+
+	UE_LOG(LogSourceControl, Log, TEXT("EvictStateCache: evicted %d/%d states and %d/%d history revisions (%d evicted states, %d forgotten)"), NumEvictedStates, StateCache.Num() + NumEvictedStates, NumEvictedRevisions, NumHistoryRevisions, EvictedStates.Num(), NumForgottenStates);
+}
+
+bool FPlasticSourceControlProvider::ProcessCompletedCommand(FPlasticSourceControlCommand& InCommand)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPlasticSourceControlProvider::ProcessCompletedCommand);
+
+	// Update workspace status and connection state on Connect and UpdateStatus operations
+	UpdateWorkspaceStatus(InCommand);
+
+	// let command update the states of any files
+	const bool bStatesUpdated = InCommand.Worker->UpdateStates();
+
+	// dump any messages to output log
+	OutputCommandMessages(InCommand);
+
+	if (InCommand.Files.Num() > 1)
+	{
+		UE_LOG(LogSourceControl, Log, TEXT("%s of %d items processed in %.3lfs"), *InCommand.Operation->GetName().ToString(), InCommand.Files.Num(), (FPlatformTime::Seconds() - InCommand.StartTimestamp));
+	}
+	else if (InCommand.Files.Num() == 1)
+	{
+		UE_LOG(LogSourceControl, Log, TEXT("%s of %s processed in %.3lfs"), *InCommand.Operation->GetName().ToString(), *InCommand.Files[0], (FPlatformTime::Seconds() - InCommand.StartTimestamp));
 	}
+	else
+	{
+		UE_LOG(LogSourceControl, Log, TEXT("%s processed in %.3lfs"), *InCommand.Operation->GetName().ToString(), (FPlatformTime::Seconds() - InCommand.StartTimestamp));
+	}
+
+	// run the completion delegate callback if we have one bound
+	InCommand.ReturnResults();
+
+	// commands that are left in the array during a tick need to be deleted
+	if (InCommand.bAutoDelete)
+	{
+		// Only delete commands that are not running 'synchronously'
+		delete &InCommand;
+	}
+
+	return bStatesUpdated;
 }
 
 TArray<TSharedRef<ISourceControlLabel>> FPlasticSourceControlProvider::GetLabels(const FString& InMatchingSpec) const
@@ -835,8 +1056,12 @@ ECommandResult::Type FPlasticSourceControlProvider::ExecuteSynchronousCommand(FP
 			FPlatformProcess::Sleep(0.01f);
 		}
 
-		// always do one more Tick() to make sure the command queue is cleaned up.
-		Tick();
+		// always Tick() until the command is processed to make sure the command queue is cleaned up
+		// (other commands completed in the meantime could consume the time budget of the first Tick)
+		while (CommandQueue.Contains(&InCommand))
+		{
+			Tick();
+		}
 
 		if (InCommand.bCommandSuccessful)
 		{
@@ -187,6 +187,9 @@ public:
 	/** Helper function used to update state cache */
 	TSharedRef<class FPlasticSourceControlState, ESPMode::ThreadSafe> GetStateInternal(const FString& InFilename);
 
+	/** Helper function used to update the state cache only for files already in it */
+	TSharedPtr<class FPlasticSourceControlState, ESPMode::ThreadSafe> FindStateInternal(const FString& InFilename) const;
+
 #if ENGINE_MAJOR_VERSION == 5
 	/** Helper function used to update changelists state cache */
 	TSharedRef<class FPlasticSourceControlChangelistState, ESPMode::ThreadSafe> GetStateInternal(const FPlasticSourceControlChangelist& InChangelist);
@@ -201,6 +204,9 @@ public:
 	/** Remove a named file from the state cache */
 	bool RemoveFileFromCache(const FString& Filename);
 
+	/** Load the next page of the history of a file in the background, if not complete and not already loading */
+	void LoadMoreHistory(const class FPlasticSourceControlState& InState);
+
 #if ENGINE_MAJOR_VERSION == 5
 	/** Remove a changelist from the state cache */
 	bool RemoveChangelistFromCache(const FPlasticSourceControlChangelist& Changelist);
@@ -252,6 +258,12 @@ private:
 	/** Issue a command asynchronously if possible. */
 	ECommandResult::Type IssueCommand(class FPlasticSourceControlCommand& InCommand);
 
+	/** Update states, output messages and run the completion delegate of a command removed from the queue. Return true if any state was updated. */
+	bool ProcessCompletedCommand(class FPlasticSourceControlCommand& InCommand);
+
+	/** Evict the least recently used file states and histories from the cache to enforce the memory budget set in the Project Settings */
+	void EvictStateCache();
+
 	/** Output any messages this command holds */
 	void OutputCommandMessages(const class FPlasticSourceControlCommand& InCommand) const;
 
@@ -304,6 +316,31 @@ private:
 	TMap<FPlasticSourceControlChangelist, TSharedRef<class FPlasticSourceControlChangelistState, ESPMode::ThreadSafe> > ChangelistsStateCache;
 #endif
 
+	/** Files with a page of history currently loading in the background */
+	TSet<FString> FilesLoadingHistory;
+
+	/** Compact state of a file evicted from the state cache: evicted files are all Controlled, unlocked, not moved and not modified in another branch, so this is enough to restore them on demand */
+	struct FEvictedState
+	{
+		FString RepSpec;
+		int32 DepotRevisionChangeset;
+		int32 LocalRevisionChangeset;
+		FDateTime TimeStamp;
+		int64 EvictionOrder;
+	};
+
+	/** Files evicted from the state cache, restored transparently on their next access (bounded by the same budget as the state cache) */
+	TMap<FString, FEvictedState> EvictedStates;
+
+	/** Monotonic counter used to prune the oldest evicted states first */
+	int64 EvictionCounter = 0;
+
+	/** Monotonic counter used to track the least recently used states of the cache */
+	volatile int64 StateCacheAccessCounter = 0;
+
+	/** Timestamp of the last check of the memory budget of the state cache */
+	double LastStateCacheEvictionTimestamp = 0.0;
+
 	/** The currently registered source control operations */
 	TMap<FName, FGetPlasticSourceControlWorker> WorkersMap;
 
@@ -11,6 +11,106 @@
 
 #define LOCTEXT_NAMESPACE "PlasticSourceControl"
 
+FPlasticSourceControlChangesetMetadataTable* FPlasticSourceControlChangesetMetadataTable::ScopedTable = nullptr;
+
+FPlasticSourceControlChangesetMetadataTable& FPlasticSourceControlChangesetMetadataTable::Get()
+{
+	static FPlasticSourceControlChangesetMetadataTable Table;
+	return ScopedTable ? *ScopedTable : Table;
+}
+
+FScopedChangesetMetadataTable::FScopedChangesetMetadataTable()
+	: PreviousTable(FPlasticSourceControlChangesetMetadataTable::ScopedTable)
+{
+	check(IsInGameThread());
+	FPlasticSourceControlChangesetMetadataTable::ScopedTable = &Table;
+}
+
+FScopedChangesetMetadataTable::~FScopedChangesetMetadataTable()
+{
+	check(IsInGameThread());
+	FPlasticSourceControlChangesetMetadataTable::ScopedTable = PreviousTable;
+}
+
+FPlasticSourceControlChangesetMetadataRef FPlasticSourceControlChangesetMetadataTable::FindOrAdd(const FString& InRepSpec, const int32 InChangesetNumber, TFunctionRef<void(FPlasticSourceControlChangesetMetadata&)> InBuildFunction)
+{
+	if (FPlasticSourceControlChangesetMetadataPtr ExistingMetadata = Find(InRepSpec, InChangesetNumber))
+	{
+		return ExistingMetadata.ToSharedRef();
+	}
+
+	// Decoding the comment is the expensive part, so build the metadata without holding the lock
+	const TSharedRef<FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe> NewMetadata = MakeShared<FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe>();
+	InBuildFunction(NewMetadata.Get());
+
+	return Add(InRepSpec, InChangesetNumber, NewMetadata);
+}
+
+FPlasticSourceControlChangesetMetadataPtr FPlasticSourceControlChangesetMetadataTable::Find(const FString& InRepSpec, const int32 InChangesetNumber)
+{
+	FShard& Shard = GetShard(InChangesetNumber);
+	FScopeLock Lock(&Shard.CriticalSection);
+	if (const TWeakPtr<const FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe>* Entry = Shard.Entries.Find(FKey(InRepSpec, InChangesetNumber)))
+	{
+		return Entry->Pin();
+	}
+	return nullptr;
+}
+
+FPlasticSourceControlChangesetMetadataRef FPlasticSourceControlChangesetMetadataTable::Add(const FString& InRepSpec, const int32 InChangesetNumber, const FPlasticSourceControlChangesetMetadataRef& InMetadata)
+{
+	FShard& Shard = GetShard(InChangesetNumber);
+	FScopeLock Lock(&Shard.CriticalSection);
+	TWeakPtr<const FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe>& Entry = Shard.Entries.FindOrAdd(FKey(InRepSpec, InChangesetNumber));
+	if (FPlasticSourceControlChangesetMetadataPtr ExistingMetadata = Entry.Pin())
+	{
+		// Another thread added the same changeset in the meantime: share its metadata
+		return ExistingMetadata.ToSharedRef();
+	}
+	Entry = InMetadata;
+
+	// Amortize the cost of purging the entries released since the last time the shard doubled in size
+	if (Shard.Entries.Num() > FMath::Max(2 * Shard.NumEntriesAtLastPurge, 1024 / NumShards))
+	{
+		Shard.PurgeExpiredEntries();
+	}
+
+	return InMetadata;
+}
+
+void FPlasticSourceControlChangesetMetadataTable::Invalidate(const FString& InRepSpec, const TArray<int32>& InChangesetNumbers)
+{
+	for (const int32 ChangesetNumber : InChangesetNumbers)
+	{
+		FShard& Shard = GetShard(ChangesetNumber);
+		FScopeLock Lock(&Shard.CriticalSection);
+		Shard.Entries.Remove(FKey(InRepSpec, ChangesetNumber));
+	}
+}
+
+void FPlasticSourceControlChangesetMetadataTable::Reset()
+{
+	for (FShard& Shard : Shards)
+	{
+		FScopeLock Lock(&Shard.CriticalSection);
+		Shard.Entries.Empty();
+		Shard.NumEntriesAtLastPurge = 0;
+	}
+}
+
+void FPlasticSourceControlChangesetMetadataTable::FShard::PurgeExpiredEntries()
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	Entries.Compact();
+	NumEntriesAtLastPurge = Entries.Num();
+}
+
 #if ENGINE_MAJOR_VERSION == 4
 bool FPlasticSourceControlRevision::Get(FString& InOutFilename) const
 #elif ENGINE_MAJOR_VERSION == 5
@@ -113,20 +213,27 @@ const FString& FPlasticSourceControlRevision::GetRevision() const
 	return Revision;
 }
 
+static const FString EmptyString;
+
 const FString& FPlasticSourceControlRevision::GetDescription() const
 {
-	return Description;
+	return ChangesetMetadata.IsValid() ? ChangesetMetadata->Description : EmptyString;
 }
 
 const FString& FPlasticSourceControlRevision::GetUserName() const
 {
-	return UserName;
+	return ChangesetMetadata.IsValid() ? ChangesetMetadata->UserName : EmptyString;
 }
 
 const FString& FPlasticSourceControlRevision::GetClientSpec() const
 {
 	// Note: show Branch instead of the Workspace of the submitter since it's Perforce only
-	return Branch;
+	return GetBranch();
+}
+
+const FString& FPlasticSourceControlRevision::GetBranch() const
+{
+	return ChangesetMetadata.IsValid() ? ChangesetMetadata->Branch : EmptyString;
 }
 
 const FString& FPlasticSourceControlRevision::GetAction() const
@@ -142,7 +249,8 @@ TSharedPtr<class ISourceControlRevision, ESPMode::ThreadSafe> FPlasticSourceCont
 
 const FDateTime& FPlasticSourceControlRevision::GetDate() const
 {
-	return Date;
+	static const FDateTime InvalidDate(0);
+	return ChangesetMetadata.IsValid() ? ChangesetMetadata->Date : InvalidDate;
 }
 
 int32 FPlasticSourceControlRevision::GetCheckInIdentifier() const
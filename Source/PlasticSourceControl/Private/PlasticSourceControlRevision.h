@@ -9,6 +9,104 @@
 
 class FPlasticSourceControlState;
 
+/** Metadata of a changeset, shared by the revisions of all the files modified by this changeset */
+class FPlasticSourceControlChangesetMetadata
+{
+public:
+	/** The description of the changeset */
+	FString Description;
+
+	/** The user that made the change */
+	FString UserName;
+
+	/** Branch where the change was made */
+	FString Branch;
+
+	/** The date the changeset was made */
+	FDateTime Date = 0;
+};
+
+typedef TSharedRef<const FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe> FPlasticSourceControlChangesetMetadataRef;
+typedef TSharedPtr<const FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe> FPlasticSourceControlChangesetMetadataPtr;
+
+/**
+ * Table of the metadata of changesets, keyed by repository spec and changeset number,
+ * so that the revisions of files modified by the same changeset share one copy of its comment, owner, date and branch.
+ * Entries are weak references, released with the last revision using them.
+ * The table is split in shards each with their own lock, so that concurrent commands rarely wait for each other.
+*/
+class FPlasticSourceControlChangesetMetadataTable
+{
+public:
+	/** The table used by the parsers, or the one of a FScopedChangesetMetadataTable */
+	static FPlasticSourceControlChangesetMetadataTable& Get();
+
+	/**
+	 * Find the metadata of a changeset, or build it with InBuildFunction and add it to the table. Thread-safe.
+	 * The metadata is built outside of the lock: if another thread added the same changeset in the meantime, its metadata is returned instead.
+	 */
+	FPlasticSourceControlChangesetMetadataRef FindOrAdd(const FString& InRepSpec, const int32 InChangesetNumber, TFunctionRef<void(FPlasticSourceControlChangesetMetadata&)> InBuildFunction);
+
+	/** Find the metadata of a changeset, if still in the table. Thread-safe. */
+	FPlasticSourceControlChangesetMetadataPtr Find(const FString& InRepSpec, const int32 InChangesetNumber);
+
+	/** Add the metadata of a changeset built by the caller, or return the one already in the table if another thread added it in the meantime. Thread-safe. */
+	FPlasticSourceControlChangesetMetadataRef Add(const FString& InRepSpec, const int32 InChangesetNumber, const FPlasticSourceControlChangesetMetadataRef& InMetadata);
+
+	/** Forget the metadata of some changesets, eg. after their comment was edited, so that it is built again on their next use (revisions already parsed keep their copy) */
+	void Invalidate(const FString& InRepSpec, const TArray<int32>& InChangesetNumbers);
+
+	/** Remove all entries from the table, eg. after a change to the display names of users */
+	void Reset();
+
+private:
+	friend class FScopedChangesetMetadataTable;
+
+	/** Table replacing the shared one, see FScopedChangesetMetadataTable */
+	static FPlasticSourceControlChangesetMetadataTable* ScopedTable;
+
+	typedef TPair<FString, int32> FKey;
+
+	struct FShard
+	{
+		FCriticalSection CriticalSection;
+		TMap<FKey, TWeakPtr<const FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe>> Entries;
+		int32 NumEntriesAtLastPurge = 0;
+
+		/** Remove entries of changesets no longer referenced by any revision */
+		void PurgeExpiredEntries();
+	};
+
+	FShard& GetShard(const int32 InChangesetNumber)
+	{
+		return Shards[static_cast<uint32>(InChangesetNumber) % NumShards];
+	}
+
+	static const int32 NumShards = 16;
+	FShard Shards[NumShards];
+};
+
+/**
+ * Replace the table returned by FPlasticSourceControlChangesetMetadataTable::Get() by an empty one during its lifetime,
+ * so that tests don't reset the table shared with the revisions of the editor session.
+ * Only meant for tests: to be created and destroyed on the game thread while no command is running.
+ */
+class FScopedChangesetMetadataTable
+{
+public:
+	FScopedChangesetMetadataTable();
+	~FScopedChangesetMetadataTable();
+
+	FPlasticSourceControlChangesetMetadataTable& Get()
+	{
+		return Table;
+	}
+
+private:
+	FPlasticSourceControlChangesetMetadataTable Table;
+	FPlasticSourceControlChangesetMetadataTable* PreviousTable;
+};
+
 /** Revision of a file, linked to a specific commit */
 class FPlasticSourceControlRevision : public ISourceControlRevision
 {
@@ -16,7 +114,6 @@ public:
 	FPlasticSourceControlRevision()
 		: ChangesetNumber(ISourceControlState::INVALID_REVISION)
 		, RevisionId(ISourceControlState::INVALID_REVISION)
-		, Date(0)
 		, FileSize(0)
 	{
 	}
@@ -41,6 +138,9 @@ public:
 	virtual int32 GetCheckInIdentifier() const override;
 	virtual int32 GetFileSize() const override;
 
+	/** Branch where the change was made */
+	const FString& GetBranch() const;
+
 public:
 	/** Point back to State this Revision is from */
 	FPlasticSourceControlState* State = nullptr;
@@ -60,14 +160,8 @@ public:
 	/** The Shelve ID instead of Changeset / Revision for case of shelved files */
 	int32 ShelveId = ISourceControlState::INVALID_REVISION;
 
-	/** The description of this revision */
-	FString Description;
-
-	/** The user that made the change */
-	FString UserName;
-
-	/** Branch where the change was made */
-	FString Branch;
+	/** The metadata of the changeset of this revision: description, user, branch and date */
+	FPlasticSourceControlChangesetMetadataPtr ChangesetMetadata;
 
 	/** The action (add, edit, branch etc.) performed at this revision */
 	FString Action;
@@ -75,9 +169,6 @@ public:
 	/** Source of move ("branch" in Perforce term) if any */
 	TSharedPtr<FPlasticSourceControlRevision, ESPMode::ThreadSafe> BranchSource;
 
-	/** The date this revision was made */
-	FDateTime Date;
-
 	/** The size of the file at this revision */
 	int32 FileSize;
 };
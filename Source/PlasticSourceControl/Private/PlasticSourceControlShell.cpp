@@ -172,6 +172,55 @@ static void _RestartBackgroundCommandLineShell(const bool bInForceExit = false)
 }
 
 // Internal function (called under the critical section)
+// Number of bytes at the end of a buffer of UTF-8 output forming the start of a multi-byte character not fully read yet
+static int32 _GetIncompleteUtf8Suffix(const TArray<uint8>& InBytes)
+{
+	// Walk back over at most 3 continuation bytes to find the leading byte of the last character
+	const int32 NumBytes = InBytes.Num();
+	for (int32 NumBack = 1; NumBack <= FMath::Min(NumBytes, 4); NumBack++)
+	{
+		const uint8 Byte = InBytes[NumBytes - NumBack];
+		if ((Byte & 0xC0) == 0x80)
+		{
+			continue; // continuation byte (10xxxxxx)
+		}
+		if ((Byte & 0xC0) == 0xC0)
+		{
+			// leading byte of a multi-byte character (110xxxxx, 1110xxxx or 11110xxx)
+			const int32 CharLen = (Byte >= 0xF0) ? 4 : (Byte >= 0xE0) ? 3 : 2;
+			return (CharLen > NumBack) ? NumBack : 0;
+		}
+		return 0; // ASCII character
+	}
+	return 0;
+}
+
+// Read the output available in a pipe, converting it from UTF-8 and carrying over to the next read the bytes of a character split between two reads
+// NOTE: ReadPipe() converts each chunk from UTF-8 separately, which would corrupt characters split between two chunks, typically in long XML outputs
+static FString _ReadPipeUtf8(void* InPipe, TArray<uint8>& InOutPendingBytes)
+{
+	TArray<uint8> Bytes;
+	if (!FPlatformProcess::ReadPipeToArray(InPipe, Bytes) || Bytes.Num() == 0)
+	{
+		return FString();
+	}
+	InOutPendingBytes.Append(MoveTemp(Bytes));
+
+	const int32 NumComplete = InOutPendingBytes.Num() - _GetIncompleteUtf8Suffix(InOutPendingBytes);
+	if (NumComplete == 0)
+	{
+		return FString();
+	}
+	const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(InOutPendingBytes.GetData()), NumComplete);
+	FString Output(Converter.Length(), Converter.Get());
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
+	InOutPendingBytes.RemoveAt(0, NumComplete, EAllowShrinking::No);
+#else
+	InOutPendingBytes.RemoveAt(0, NumComplete, false);
+#endif
+	return Output;
+}
+
 static bool _RunCommandInternal(const FString& InCommand, const TArray<FString>& InParameters, const TArray<FString>& InFiles, FString& OutResults, FString& OutErrors)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlShell::_RunCommandInternal);
@@ -207,7 +256,7 @@ static bool _RunCommandInternal(const FString& InCommand, const TArray<FString>&
 
 	// Send command to 'cm shell' process in UTF-8
 	// NOTE: this explicit conversion to UTF-8 shouldn't be needed since FPlatformProcess::WritePipe() says it does it, but reading the implementation for Windows Platform show it merily truncates 16bits to 8bits chars!
-	// NOTE: on the other hand, ReadPipe() does the conversion from UTF-8 correctly already!
+	// NOTE: on the other hand, the output is read as raw bytes and converted from UTF-8 by _ReadPipeUtf8()
 	const FTCHARToUTF8 FullCommandUtf8(*FullCommand);
 	const bool bWriteOk = FPlatformProcess::WritePipe(ShellInputPipeWrite, reinterpret_cast<const uint8*>(FullCommandUtf8.Get()), FullCommandUtf8.Length());
 
@@ -218,14 +267,16 @@ static bool _RunCommandInternal(const FString& InCommand, const TArray<FString>&
 	double LastLog = StartTimestamp;
 	static const double LogInterval = 10.0; // log interval for long running operation
 	int32 PreviousLogLen = 0;
+	TArray<uint8> PendingErrorBytes;
+	TArray<uint8> PendingOutputBytes;
 	while (FPlatformProcess::IsProcRunning(ShellProcessHandle))
 	{
-		FString Errors = FPlatformProcess::ReadPipe(ShellErrorPipeRead);
+		FString Errors = _ReadPipeUtf8(ShellErrorPipeRead, PendingErrorBytes);
 		if (!Errors.IsEmpty())
 		{
 			OutErrors.Append(Errors);
 		}
-		FString Output = FPlatformProcess::ReadPipe(ShellOutputPipeRead);
+		FString Output = _ReadPipeUtf8(ShellOutputPipeRead, PendingOutputBytes);
 		if (!Output.IsEmpty())
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlShell::_RunCommandInternal::ParseOutput);
@@ -1,6 +1,7 @@
 // Copyright (c) 2024 Unity Technologies
 
 #include "PlasticSourceControlState.h"
+#include "PlasticSourceControlModule.h"
 #include "PlasticSourceControlProjectSettings.h"
 
 #include "Misc/Paths.h"
@@ -80,63 +81,88 @@ int32 FPlasticSourceControlState::GetHistorySize() const
 TSharedPtr<class ISourceControlRevision, ESPMode::ThreadSafe> FPlasticSourceControlState::GetHistoryItem(int32 HistoryIndex) const
 {
 	check(History.IsValidIndex(HistoryIndex));
+
+	// Load the next page of the history in the background when reaching the last revision loaded so far
+	if ((HistoryIndex == History.Num() - 1) && !bHistoryComplete)
+	{
+		FPlasticSourceControlModule::Get().GetProvider().LoadMoreHistory(*this);
+	}
+
 	return History[HistoryIndex];
 }
 
-TSharedPtr<class ISourceControlRevision, ESPMode::ThreadSafe> FPlasticSourceControlState::FindHistoryRevision(int32 RevisionNumber) const
+/**
+ * Find a revision in the history of a file.
+ * Only a first page of the history of a selection of files might have been loaded: if the revision is older, the next page is loaded in the background,
+ * without blocking the caller, and the revision can be found in the cached state of the file once loaded.
+ */
+template<typename PredicateType>
+static TSharedPtr<FPlasticSourceControlRevision, ESPMode::ThreadSafe> FindRevision(const FPlasticSourceControlState& InState, PredicateType InPredicate)
 {
-	for (const auto& Revision : History)
+	auto FindInHistory = [&InPredicate](const TPlasticSourceControlHistory& InHistory) -> TSharedPtr<FPlasticSourceControlRevision, ESPMode::ThreadSafe>
 	{
-		if (Revision->GetRevisionNumber() == RevisionNumber)
+		for (const auto& Revision : InHistory)
 		{
-			return Revision;
+			if (InPredicate(*Revision))
+			{
+				return Revision;
+			}
 		}
+		return nullptr;
+	};
+
+	TSharedPtr<FPlasticSourceControlRevision, ESPMode::ThreadSafe> Revision = FindInHistory(InState.History);
+	if (!Revision.IsValid() && !InState.bHistoryComplete)
+	{
+		FPlasticSourceControlModule::Get().GetProvider().LoadMoreHistory(InState);
 	}
+	return Revision;
+}
 
-	return nullptr;
+TSharedPtr<class ISourceControlRevision, ESPMode::ThreadSafe> FPlasticSourceControlState::FindHistoryRevision(int32 RevisionNumber) const
+{
+	return FindRevision(*this, [RevisionNumber](const FPlasticSourceControlRevision& InRevision)
+	{
+		return InRevision.GetRevisionNumber() == RevisionNumber;
+	});
 }
 
 TSharedPtr<class ISourceControlRevision, ESPMode::ThreadSafe> FPlasticSourceControlState::FindHistoryRevision(const FString& InRevision) const
 {
-	for (const auto& Revision : History)
+	return FindRevision(*this, [&InRevision](const FPlasticSourceControlRevision& InRevisionToCheck)
 	{
-		if (Revision->GetRevision() == InRevision)
-		{
-			return Revision;
-		}
-	}
-
-	return nullptr;
+		return InRevisionToCheck.GetRevision() == InRevision;
+	});
 }
 
 #if ENGINE_MAJOR_VERSION == 4 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 3)
 TSharedPtr<class ISourceControlRevision, ESPMode::ThreadSafe> FPlasticSourceControlState::GetBaseRevForMerge() const
 {
-	for (const auto& Revision : History)
+	if (PendingMergeBaseChangeset == INVALID_REVISION)
 	{
-		// look for the changeset number, not the revision
-		if (Revision->ChangesetNumber == PendingMergeBaseChangeset)
-		{
-			return Revision;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	// look for the changeset number, not the revision
+	return FindRevision(*this, [this](const FPlasticSourceControlRevision& InRevision)
+	{
+		return InRevision.ChangesetNumber == PendingMergeBaseChangeset;
+	});
 }
 #endif
 
 TSharedPtr<class ISourceControlRevision, ESPMode::ThreadSafe> FPlasticSourceControlState::GetCurrentRevision() const
 {
-	for (const auto& Revision : History)
+	if (LocalRevisionChangeset == INVALID_REVISION)
 	{
-		// look for the changeset number, not the revision
-		if (Revision->ChangesetNumber == LocalRevisionChangeset)
-		{
-			return Revision;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	// look for the changeset number, not the revision
+	return FindRevision(*this, [this](const FPlasticSourceControlRevision& InRevision)
+	{
+		return InRevision.ChangesetNumber == LocalRevisionChangeset;
+	});
 }
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
@@ -78,6 +78,8 @@ public:
 		if (InState.History.Num() > 0)
 		{
 			History = MoveTemp(InState.History);
+			HistoryLimit = InState.HistoryLimit;
+			bHistoryComplete = InState.bHistoryComplete;
 		}
 		LocalFilename = MoveTemp(InState.LocalFilename);
 		WorkspaceState = InState.WorkspaceState;
@@ -185,6 +187,12 @@ public:
 	/** History of the item, if any */
 	TPlasticSourceControlHistory History;
 
+	/** Number of revisions requested for the History, ie the range loaded so far (0 if not loaded or without limit) */
+	int32 HistoryLimit = 0;
+
+	/** True if the History contains all the revisions of the file, false if more can be loaded on demand */
+	bool bHistoryComplete = false;
+
 	/** Filename on disk */
 	FString LocalFilename;
 
@@ -246,6 +254,9 @@ public:
 	/** The timestamp of the last update */
 	FDateTime TimeStamp = 0;
 
+	/** Order of the last access to this state through the Provider cache, used to evict the least recently used ones (not moved with the state) */
+	int64 LastAccess = 0;
+
 	/** The branch with the head change list */
 	FString HeadBranch;
 
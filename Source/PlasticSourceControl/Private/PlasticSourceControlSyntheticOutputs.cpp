@@ -0,0 +1,297 @@
+// Copyright (c) 2024 Unity Technologies
+
+#include "PlasticSourceControlSyntheticOutputs.h"
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+namespace PlasticSourceControlSyntheticOutputs
+{
+
+const TCHAR* WorkspaceRoot = TEXT("C:/Workspace/SyntheticProject/");
+
+static const TCHAR* RepSpec = TEXT("SyntheticProject@localhost:8087");
+
+static const int32 NumFilesPerDirectory = 100;
+
+// Server path of a generated file, relative to the root of the workspace, eg "/Content/Folder0042/Asset_004217.uasset"
+static FString ServerPath(const FString& InFile)
+{
+	return TEXT("/") + InFile.RightChop(FCString::Strlen(WorkspaceRoot));
+}
+
+// Comment of a changeset: one out of four contains XML entities to exercise their decoding
+static FString ChangesetComment(const int32 InChangesetId)
+{
+	if (InChangesetId % 4 == 1)
+	{
+		return FString::Printf(TEXT("Fix &amp; tweak &lt;assets&gt; of &quot;level %d&quot;"), InChangesetId);
+	}
+	return FString::Printf(TEXT("Update the assets of level %d"), InChangesetId);
+}
+
+// Comment of a changeset as printed by the --format of 'cm find': not XML encoded, and one out of four spans two lines
+static void AddFormatComment(const int32 InChangesetId, FString& InOutLastField, TArray<FString>& OutLines)
+{
+	if (InChangesetId % 4 == 1)
+	{
+		InOutLastField += FString::Printf(TEXT("Fix & tweak <assets> of \"level %d\""), InChangesetId);
+		OutLines.Add(MoveTemp(InOutLastField));
+		OutLines.Add(TEXT("Second line of the comment"));
+	}
+	else
+	{
+		InOutLastField += FString::Printf(TEXT("Update the assets of level %d"), InChangesetId);
+		OutLines.Add(MoveTemp(InOutLastField));
+	}
+}
+
+static FString Owner(const int32 InIndex)
+{
+	return FString::Printf(TEXT("user%d@example.com"), InIndex % 16);
+}
+
+// ISO 8601 date of a changeset, one hour apart from the previous one
+static FString ChangesetDate(const int32 InChangesetId)
+{
+	const FDateTime Date = FDateTime(2024, 1, 1) + FTimespan::FromHours(InChangesetId);
+	return Date.ToIso8601();
+}
+
+TArray<FString> GenerateFilenames(const int32 InNumFiles)
+{
+	TArray<FString> Files;
+	Files.Reserve(InNumFiles);
+	for (int32 FileIndex = 0; FileIndex < InNumFiles; FileIndex++)
+	{
+		Files.Add(FString::Printf(TEXT("%sContent/Folder%04d/Asset_%06d.uasset"), WorkspaceRoot, FileIndex / NumFilesPerDirectory, FileIndex));
+	}
+	return Files;
+}
+
+TArray<FString> GenerateStatus(const TArray<FString>& InFiles)
+{
+	static const TCHAR* Statuses[] = { TEXT("CH"), TEXT("CO"), TEXT("CO+CH"), TEXT("CO+CP"), TEXT("CO+RP"), TEXT("AD"), TEXT("PR"), TEXT("IG"), TEXT("DE"), TEXT("LD"), TEXT("MV") };
+
+	TArray<FString> Results;
+	Results.Reserve(InFiles.Num());
+	for (int32 FileIndex = 0; FileIndex < InFiles.Num(); FileIndex++)
+	{
+		const TCHAR* Status = Statuses[FileIndex % UE_ARRAY_COUNT(Statuses)];
+		if (FCString::Strcmp(Status, TEXT("MV")) == 0)
+		{
+			Results.Add(FString::Printf(TEXT("MV;100%%;%s.old;%s;False;NO_MERGES"), *InFiles[FileIndex], *InFiles[FileIndex]));
+		}
+		else
+		{
+			Results.Add(FString::Printf(TEXT("%s;%s;False;NO_MERGES"), Status, *InFiles[FileIndex]));
+		}
+	}
+	return Results;
+}
+
+TArray<FString> GenerateFileinfo(const TArray<FString>& InFiles)
+{
+	TArray<FString> Results;
+	Results.Reserve(InFiles.Num());
+	for (int32 FileIndex = 0; FileIndex < InFiles.Num(); FileIndex++)
+	{
+		const int32 RevisionChangeset = 1 + FileIndex % 1000;
+		// One file out of eight is out of date
+		const int32 RevisionHeadChangeset = (FileIndex % 8 == 0) ? RevisionChangeset + 1 : RevisionChangeset;
+		Results.Add(FString::Printf(TEXT("%d;%d;%s;;;%s"), RevisionChangeset, RevisionHeadChangeset, RepSpec, *ServerPath(InFiles[FileIndex])));
+	}
+	return Results;
+}
+
+TArray<FString> GenerateLockList(const TArray<FString>& InFiles)
+{
+	TArray<FString> Results;
+	Results.Reserve(InFiles.Num() / 10 + 1);
+	for (int32 FileIndex = 0; FileIndex < InFiles.Num(); FileIndex += 10)
+	{
+		// {LockId};{ItemId};{Guid};{Date};{DestinationBranch};{DestinationBranchId};{Branch};{RevisionId};{Status};{Owner};{Workspace};{Path}
+		const bool bIsLocked = (FileIndex % 20 == 0);
+		Results.Add(FString::Printf(TEXT("%d;%d;%s;%s;/main;3;%s;%d;%s;%s;Workspace_%d;%s"),
+			FileIndex, 1000 + FileIndex,
+			*FGuid(FileIndex, 0, 0, 0).ToString(EGuidFormats::DigitsWithHyphens),
+			*ChangesetDate(FileIndex).Left(19),
+			bIsLocked ? TEXT("/main") : TEXT("/main/feature"),
+			2000 + FileIndex,
+			bIsLocked ? TEXT("Locked") : TEXT("Retained"),
+			*Owner(FileIndex),
+			FileIndex % 16,
+			*ServerPath(InFiles[FileIndex])
+		));
+	}
+	return Results;
+}
+
+TArray<FString> GenerateSmartLockList(const TArray<FString>& InFiles)
+{
+	static const TCHAR* DestinationBranches[] = { TEXT("/main"), TEXT("/main/release"), TEXT("/main/release2"), TEXT("/dev") };
+
+	TArray<FString> Results;
+	Results.Reserve(InFiles.Num() / 3 + 1);
+	for (int32 FileIndex = 0; FileIndex < InFiles.Num(); FileIndex += 5)
+	{
+		// One locked file out of three is also locked for the "/main" destination branch
+		const int32 NumLocks = ((FileIndex / 5) % 3 == 0) ? 2 : 1;
+		for (int32 LockIndex = 0; LockIndex < NumLocks; LockIndex++)
+		{
+			const FString DestinationBranch = (LockIndex == 0) ? DestinationBranches[(FileIndex / 5) % UE_ARRAY_COUNT(DestinationBranches)] : TEXT("/main");
+
+			// {LockId};{ItemId};{Guid};{Date};{DestinationBranch};{DestinationBranchId};{Branch};{RevisionId};{Status};{Owner};{Workspace};{Path}
+			const bool bIsLocked = (FileIndex % 10 == 0);
+			Results.Add(FString::Printf(TEXT("%d;%d;%s;%s;%s;3;%s;%d;%s;%s;Workspace_%d;%s"),
+				FileIndex * 2 + LockIndex, 1000 + FileIndex,
+				*FGuid(FileIndex, LockIndex, 0, 0).ToString(EGuidFormats::DigitsWithHyphens),
+				*ChangesetDate(FileIndex).Left(19),
+				*DestinationBranch,
+				bIsLocked ? *DestinationBranch : *(DestinationBranch + TEXT("/feature")),
+				2000 + FileIndex,
+				bIsLocked ? TEXT("Locked") : TEXT("Retained"),
+				*Owner(FileIndex),
+				FileIndex % 16,
+				*ServerPath(InFiles[FileIndex])
+			));
+		}
+	}
+	return Results;
+}
+
+FString GenerateChangelistsXml(const TArray<FString>& InFiles, const int32 InNumChangelists)
+{
+	FString Xml;
+	Xml.Reserve(InFiles.Num() * 250);
+	Xml += TEXT("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<StatusOutput>\n  <WkConfigType>Branch</WkConfigType>\n  <WkConfigName>/main@rep:SyntheticProject@repserver:localhost:8087</WkConfigName>\n  <Changelists>\n");
+	for (int32 ChangelistIndex = 0; ChangelistIndex < InNumChangelists; ChangelistIndex++)
+	{
+		if (ChangelistIndex == 0)
+		{
+			Xml += TEXT("    <Changelist>\n      <Name>Default</Name>\n      <Description>Default Unity Version Control changelist</Description>\n      <Changes>\n");
+		}
+		else
+		{
+			Xml += FString::Printf(TEXT("    <Changelist>\n      <Name>%d</Name>\n      <Description>Changes of level %d</Description>\n      <Changes>\n"), 100 + ChangelistIndex, ChangelistIndex);
+		}
+		for (int32 FileIndex = ChangelistIndex; FileIndex < InFiles.Num(); FileIndex += InNumChangelists)
+		{
+			const FString Path = InFiles[FileIndex].RightChop(FCString::Strlen(WorkspaceRoot));
+			if (FileIndex % 10 == 0)
+			{
+				// A moved file is listed first as changed, then as moved
+				Xml += FString::Printf(TEXT("        <Change>\n          <Type>CH</Type>\n          <Path>%s</Path>\n          <OldPath />\n        </Change>\n"), *Path);
+				Xml += FString::Printf(TEXT("        <Change>\n          <Type>MV</Type>\n          <Path>%s</Path>\n          <OldPath>%s.old</OldPath>\n        </Change>\n"), *Path, *Path);
+			}
+			else
+			{
+				Xml += FString::Printf(TEXT("        <Change>\n          <Type>%s</Type>\n          <Path>%s</Path>\n          <OldPath />\n        </Change>\n"), (FileIndex % 3 == 0) ? TEXT("CO") : TEXT("CH"), *Path);
+			}
+		}
+		Xml += TEXT("      </Changes>\n    </Changelist>\n");
+	}
+	Xml += TEXT("  </Changelists>\n</StatusOutput>\n");
+	return Xml;
+}
+
+FString GenerateUpdateXml(const TArray<FString>& InFiles)
+{
+	FString Xml;
+	Xml.Reserve(InFiles.Num() * 300);
+	Xml += TEXT("<?xml version=\"1.0\" encoding=\"utf-8\" ?>\n<UpdatedItems>\n  <List>\n");
+	for (int32 FileIndex = 0; FileIndex < InFiles.Num(); FileIndex++)
+	{
+		// A file both moved and changed is listed twice
+		const int32 NumItems = (FileIndex % 10 == 0) ? 2 : 1;
+		for (int32 ItemIndex = 0; ItemIndex < NumItems; ItemIndex++)
+		{
+			Xml += FString::Printf(TEXT("    <UpdatedItem>\n      <Path>%s</Path>\n      <User>%s</User>\n      <Changeset>%d</Changeset>\n      <Date>%s</Date>\n    </UpdatedItem>\n"),
+				*InFiles[FileIndex].Replace(TEXT("/"), TEXT("\\")), *Owner(FileIndex), 1 + FileIndex % 1000, *ChangesetDate(1 + FileIndex % 1000));
+		}
+	}
+	Xml += TEXT("  </List>\n</UpdatedItems>\n");
+	return Xml;
+}
+
+FString GenerateHistoryXml(const TArray<FString>& InFiles, const int32 InNumRevisions)
+{
+	FString Xml;
+	Xml.Reserve(InFiles.Num() * (100 + InNumRevisions * 700));
+	Xml += TEXT("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<RevisionHistoriesResult>\n  <RevisionHistories>\n");
+	for (int32 FileIndex = 0; FileIndex < InFiles.Num(); FileIndex++)
+	{
+		const FString& File = InFiles[FileIndex];
+		Xml += FString::Printf(TEXT("    <RevisionHistory>\n      <ItemName>%s</ItemName>\n      <Revisions>\n"), *File);
+		// Revisions are listed from the oldest to the most recent, the changesets being shared between files of the same directory
+		for (int32 RevisionIndex = 0; RevisionIndex < InNumRevisions; RevisionIndex++)
+		{
+			const int32 ChangesetId = 1 + RevisionIndex * NumFilesPerDirectory + (FileIndex / NumFilesPerDirectory) % NumFilesPerDirectory;
+			Xml += FString::Printf(TEXT("        <Revision>\n          <RevisionSpec>%s#cs:%d</RevisionSpec>\n          <Branch>/main</Branch>\n          <CreationDate>%s</CreationDate>\n          <RevisionType>bin</RevisionType>\n          <ChangesetNumber>%d</ChangesetNumber>\n          <Owner>%s</Owner>\n          <Comment>%s</Comment>\n          <Repository>SyntheticProject</Repository>\n          <Server>localhost:8087</Server>\n          <RepositorySpec>%s</RepositorySpec>\n          <DataStatus>Available</DataStatus>\n          <ItemId>%d</ItemId>\n          <Size>%d</Size>\n          <Hash>zzuB6G9fbWz1md12+tvBxg==</Hash>\n        </Revision>\n"),
+				*File, ChangesetId, *ChangesetDate(ChangesetId), ChangesetId, *Owner(ChangesetId), *ChangesetComment(ChangesetId), RepSpec, 1000 + FileIndex, 20000 + RevisionIndex * 100);
+		}
+		Xml += TEXT("      </Revisions>\n    </RevisionHistory>\n");
+	}
+	Xml += TEXT("  </RevisionHistories>\n</RevisionHistoriesResult>\n");
+	return Xml;
+}
+
+FString GenerateChangesetsXml(const int32 InNumChangesets)
+{
+	FString Xml;
+	Xml.Reserve(InNumChangesets * 600);
+	Xml += TEXT("<?xml version=\"1.0\" encoding=\"utf-8\" ?>\n<PLASTICQUERY>\n");
+	// Changesets are listed from the most recent, as with "order by ChangesetId desc"
+	for (int32 ChangesetId = InNumChangesets; ChangesetId > 0; ChangesetId--)
+	{
+		Xml += FString::Printf(TEXT("  <CHANGESET>\n    <ID>%d</ID>\n    <CHANGESETID>%d</CHANGESETID>\n    <COMMENT>%s</COMMENT>\n    <DATE>%s</DATE>\n    <OWNER>%s</OWNER>\n    <REPOSITORY>SyntheticProject</REPOSITORY>\n    <REPNAME>SyntheticProject</REPNAME>\n    <REPSERVER>localhost:8087</REPSERVER>\n    <BRANCH>/main/task%03d</BRANCH>\n    <PARENT>%d</PARENT>\n    <GUID>%s</GUID>\n    <ROOTREV>%d</ROOTREV>\n  </CHANGESET>\n"),
+			1000 + ChangesetId, ChangesetId, *ChangesetComment(ChangesetId), *ChangesetDate(ChangesetId), *Owner(ChangesetId), ChangesetId % 100, ChangesetId - 1,
+			*FGuid(ChangesetId, 1, 0, 0).ToString(EGuidFormats::DigitsWithHyphens), 2000 + ChangesetId);
+	}
+	Xml += TEXT("</PLASTICQUERY>\n");
+	return Xml;
+}
+
+TArray<FString> GenerateChangesetsFormat(const int32 InNumChangesets)
+{
+	TArray<FString> Lines;
+	Lines.Reserve(InNumChangesets + InNumChangesets / 4 + 1);
+	for (int32 ChangesetId = InNumChangesets; ChangesetId > 0; ChangesetId--)
+	{
+		FString Line = FString::Printf(TEXT("#_#%d#_#%s#_#%s#_#/main/task%03d#_#"), ChangesetId, *ChangesetDate(ChangesetId), *Owner(ChangesetId), ChangesetId % 100);
+		AddFormatComment(ChangesetId, Line, Lines);
+	}
+	return Lines;
+}
+
+FString GenerateBranchesXml(const int32 InNumBranches)
+{
+	FString Xml;
+	Xml.Reserve(InNumBranches * 500);
+	Xml += TEXT("<?xml version=\"1.0\" encoding=\"utf-8\" ?>\n<PLASTICQUERY>\n");
+	for (int32 BranchIndex = 0; BranchIndex < InNumBranches; BranchIndex++)
+	{
+		const FString Name = (BranchIndex == 0) ? FString(TEXT("/main")) : FString::Printf(TEXT("/main/task%06d"), BranchIndex);
+		Xml += FString::Printf(TEXT("  <BRANCH>\n    <ID>%d</ID>\n    <COMMENT>%s</COMMENT>\n    <DATE>%s</DATE>\n    <OWNER>%s</OWNER>\n    <NAME>%s</NAME>\n    <PARENT>%s</PARENT>\n    <REPOSITORY>SyntheticProject</REPOSITORY>\n    <REPNAME>SyntheticProject</REPNAME>\n    <REPSERVER>localhost:8087</REPSERVER>\n    <TYPE>T</TYPE>\n    <CHANGESET>%d</CHANGESET>\n    <GUID>%s</GUID>\n  </BRANCH>\n"),
+			3 + BranchIndex, *ChangesetComment(BranchIndex), *ChangesetDate(BranchIndex), *Owner(BranchIndex), *Name, (BranchIndex == 0) ? TEXT("") : TEXT("/main"), BranchIndex,
+			*FGuid(BranchIndex, 2, 0, 0).ToString(EGuidFormats::DigitsWithHyphens));
+	}
+	Xml += TEXT("</PLASTICQUERY>\n");
+	return Xml;
+}
+
+TArray<FString> GenerateBranchesFormat(const int32 InNumBranches)
+{
+	TArray<FString> Lines;
+	Lines.Reserve(InNumBranches + InNumBranches / 4 + 1);
+	for (int32 BranchIndex = 0; BranchIndex < InNumBranches; BranchIndex++)
+	{
+		const FString Name = (BranchIndex == 0) ? FString(TEXT("/main")) : FString::Printf(TEXT("/main/task%06d"), BranchIndex);
+		FString Line = FString::Printf(TEXT("#_#%s#_#%s#_#%s#_#SyntheticProject#_#localhost:8087#_#"), *Name, *ChangesetDate(BranchIndex), *Owner(BranchIndex));
+		AddFormatComment(BranchIndex, Line, Lines);
+	}
+	return Lines;
+}
+
+} // namespace PlasticSourceControlSyntheticOutputs
+
+#endif
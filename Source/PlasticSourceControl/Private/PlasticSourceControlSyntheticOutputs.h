@@ -0,0 +1,92 @@
+// Copyright (c) 2024 Unity Technologies
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Generators of synthetic but realistic outputs of cm commands, to exercise the parsers at scale in automation tests and benchmarks.
+ *
+ * The outputs are deterministic: the same parameters always produce the same content.
+ */
+namespace PlasticSourceControlSyntheticOutputs
+{
+
+/** Workspace root used by all the generated outputs */
+extern const TCHAR* WorkspaceRoot;
+
+/**
+ * Generate absolute filenames of assets in the workspace, spread over sub-directories
+ * @param	InNumFiles		Number of filenames to generate
+ */
+TArray<FString> GenerateFilenames(const int32 InNumFiles);
+
+/**
+ * Generate the results of a 'cm status --machinereadable --fieldseparator=";"' command, with a mix of all the statuses
+ * @param	InFiles			Files to generate a status for
+ */
+TArray<FString> GenerateStatus(const TArray<FString>& InFiles);
+
+/**
+ * Generate the results of a 'cm fileinfo --format="{RevisionChangeset};{RevisionHeadChangeset};{RepSpec};{LockedBy};{LockedWhere};{ServerPath}"' command
+ * @param	InFiles			Files to generate the infos for
+ */
+TArray<FString> GenerateFileinfo(const TArray<FString>& InFiles);
+
+/**
+ * Generate the results of a 'cm lock list --machinereadable --smartlocks --fieldseparator=";"' command, locking one file out of ten
+ * @param	InFiles			Files to lock
+ */
+TArray<FString> GenerateLockList(const TArray<FString>& InFiles);
+
+/**
+ * Generate the results of a 'cm lock list --machinereadable --smartlocks --fieldseparator=";"' command over multiple destination branches
+ * @param	InFiles			Files to lock, one out of five
+ */
+TArray<FString> GenerateSmartLockList(const TArray<FString>& InFiles);
+
+/**
+ * Generate the XML results of a 'cm status --changelists --xml' command, with one file out of ten moved, thus listed twice
+ * @param	InFiles			Files pending in the changelists
+ * @param	InNumChangelists	Number of changelists, the first one being the Default changelist
+ */
+FString GenerateChangelistsXml(const TArray<FString>& InFiles, const int32 InNumChangelists);
+
+/**
+ * Generate the XML results of a 'cm update --xml' command, with one file out of ten listed twice
+ * @param	InFiles			Files updated
+ */
+FString GenerateUpdateXml(const TArray<FString>& InFiles);
+
+/**
+ * Generate the XML results of a 'cm history --moveddeleted --xml' command
+ * @param	InFiles			Files to generate a history for
+ * @param	InNumRevisions	Number of revisions in the history of each file
+ */
+FString GenerateHistoryXml(const TArray<FString>& InFiles, const int32 InNumRevisions);
+
+/**
+ * Generate the XML results of a 'cm find changesets --xml' command
+ * @param	InNumChangesets	Number of changesets
+ */
+FString GenerateChangesetsXml(const int32 InNumChangesets);
+
+/**
+ * Generate the results of a 'cm find changesets --format' command, with the same changesets as GenerateChangesetsXml()
+ * @param	InNumChangesets	Number of changesets
+ */
+TArray<FString> GenerateChangesetsFormat(const int32 InNumChangesets);
+
+/**
+ * Generate the XML results of a 'cm find branches --xml' command
+ * @param	InNumBranches	Number of branches
+ */
+FString GenerateBranchesXml(const int32 InNumBranches);
+
+/**
+ * Generate the results of a 'cm find branches --format' command, with the same branches as GenerateBranchesXml()
+ * @param	InNumBranches	Number of branches
+ */
+TArray<FString> GenerateBranchesFormat(const int32 InNumBranches);
+
+} // namespace PlasticSourceControlSyntheticOutputs
@@ -5,6 +5,7 @@
 #include "PlasticSourceControlBranch.h"
 #include "PlasticSourceControlChangeset.h"
 #include "PlasticSourceControlCommand.h"
+#include "PlasticSourceControlHistoryCache.h"
 #include "PlasticSourceControlLock.h"
 #include "PlasticSourceControlModule.h"
 #include "PlasticSourceControlParsers.h"
@@ -16,8 +17,11 @@
 #include "PlasticSourceControlVersions.h"
 #include "ISourceControlModule.h"
 
+#include "Async/Async.h"
+
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
 #include "SoftwareVersion.h"
 #include "ScopedTempFile.h"
 
@@ -67,6 +71,60 @@ bool RunCommand(const FString& InCommand, const TArray<FString>& InParameters, c
 	return bResult;
 }
 
+/**
+ * Helper to get in memory the XML result of a cm command, using the "--xml" parameter:
+ * either written by cm to a temporary file and then loaded back from the disk,
+ * or captured directly from the output of the shell (see bReadXmlResultsFromShellOutput)
+ */
+class FXmlResultOutput
+{
+public:
+	explicit FXmlResultOutput(const TCHAR* InPrefix)
+	{
+		if (!GetDefault<UPlasticSourceControlProjectSettings>()->bReadXmlResultsFromShellOutput)
+		{
+			TempFile = MakeUnique<FScopedTempFile>(InPrefix, TEXT(".xml"));
+		}
+	}
+
+	/** The "--xml" parameter of the command, with the temporary file to write to if any */
+	FString GetParameter() const
+	{
+		if (TempFile.IsValid())
+		{
+			return FString::Printf(TEXT("--xml=\"%s\""), *TempFile->GetFilename());
+		}
+
+		return FString(TEXT("--xml"));
+	}
+
+	/** Get the XML result into InOutResults, either loading the temporary file, or keeping the output of the shell already there */
+	bool Load(FString& InOutResults) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::FXmlResultOutput::Load);
+
+		if (TempFile.IsValid())
+		{
+			InOutResults.Reset();
+			return FPaths::FileExists(TempFile->GetFilename()) && FFileHelper::LoadFileToString(InOutResults, *TempFile->GetFilename());
+		}
+
+		return !InOutResults.IsEmpty();
+	}
+
+private:
+	/** Temporary file written by cm, when not reading its result from the output of the shell */
+	TUniquePtr<FScopedTempFile> TempFile;
+};
+
+// Split the raw errors output of a command into lines, appended to the array of error messages
+static void AppendErrorMessages(const FString& InErrors, TArray<FString>& OutErrorMessages)
+{
+	TArray<FString> ParsedErrors;
+	InErrors.ParseIntoArray(ParsedErrors, PlasticSourceControlShell::pchDelim, true);
+	OutErrorMessages.Append(MoveTemp(ParsedErrors));
+}
+
 FString FindPlasticBinaryPath()
 {
 #if PLATFORM_WINDOWS
@@ -485,62 +543,294 @@ static bool RunStatus(const FString& InDir, TArray<FString>&& InFiles, const ESt
 	return bResult;
 }
 
-// Cache Locks with a Timestamp, and an InvalidateCachedLocks() function
+// Delay before the expiration of the cache of locks from which it is refreshed in the background, if the locks were used and no command is running
+static const double LocksCacheRefreshAheadSeconds = 30.0;
+
+// Immutable snapshot of the cache of locks: the locks of a repository, optionally for a working branch, with their indices, and the time they were retrieved.
+// Replaced as a whole by the writers, so that readers can use it without holding any lock.
+class FLocksSnapshot
+{
+public:
+	FLocksSnapshot(const FString& InRepositorySpecification, const FString& InWorkingBranch, const FPlasticSourceControlLocksIndexRef& InLocksIndex, const FDateTime& InTimestamp)
+		: RepositorySpecification(InRepositorySpecification)
+		, WorkingBranch(InWorkingBranch)
+		, LocksIndex(InLocksIndex)
+		, Timestamp(InTimestamp)
+	{
+	}
+
+	const FString RepositorySpecification;
+	const FString WorkingBranch;
+	const FPlasticSourceControlLocksIndexRef LocksIndex;
+	const FDateTime Timestamp;
+};
+
+typedef TSharedRef<const FLocksSnapshot, ESPMode::ThreadSafe> FLocksSnapshotRef;
+typedef TSharedPtr<const FLocksSnapshot, ESPMode::ThreadSafe> FLocksSnapshotPtr;
+
+// Cache Locks of a repository, indexed by path and item id, with a Timestamp, and an InvalidateCachedLocks() function
+//
+// The locks are only served for the repository and the working branch they were listed for, in case the workspace was switched to another one.
+//
+// Once expired, the locks are still served while a single background refresh runs (stale-while-revalidate),
+// up to a maximum staleness after which the caller has to wait for the lock list command.
+//
+// Readers get a reference to the current snapshot, the read lock being held only to copy the shared pointer,
+// since there is no atomic shared pointer in the Engine; writers build a new snapshot and swap it in.
 class FLocksCache
 {
 public:
+	// Expire the cache, but keep the locks to reuse the ones that didn't change when loading the next list
+	// Note: an invalidated cache is never served stale, since the locks are known to have changed
+	void Invalidate()
+	{
+		FWriteScopeLock WriteLock(SnapshotLock);
+		if (Snapshot.IsValid())
+		{
+			Snapshot = MakeShared<const FLocksSnapshot, ESPMode::ThreadSafe>(Snapshot->RepositorySpecification, Snapshot->WorkingBranch, Snapshot->LocksIndex, FDateTime());
+		}
+	}
+
+	// Forget all the locks, eg. when the provider is closed, after waiting for the background refresh since it uses the cm shell and the cache
+	// Note: only called from the game thread
 	void Reset()
 	{
-		FScopeLock Lock(&CriticalSection);
-		Locks.Reset();
-		Timestamp = FDateTime();
+		if (RefreshFuture.IsValid())
+		{
+			RefreshFuture.Wait();
+			RefreshFuture.Reset();
+		}
+		{
+			FWriteScopeLock WriteLock(SnapshotLock);
+			Snapshot.Reset();
+		}
+		FPlatformAtomics::InterlockedExchange(&bRefreshRequested, 0);
+		FPlatformAtomics::InterlockedExchange(&bRefreshInProgress, 0);
+		FPlatformAtomics::InterlockedExchange(&bUsedSinceUpdate, 0);
+		LastRefreshTimestamp = FDateTime();
+	}
+
+	// Note: only called with the FetchCriticalSection held, so there is no concurrent update
+	FPlasticSourceControlLocksIndexRef UpdateLocks(const FString& InRepositorySpecification, const FString& InWorkingBranch, TArray<FPlasticSourceControlLock>&& InLocks)
+	{
+		// Only compare the new locks to the previous ones of the same repository and working branch
+		const FLocksSnapshotPtr PreviousSnapshot = GetSnapshot(InRepositorySpecification, InWorkingBranch);
+		const FPlasticSourceControlLocksIndexRef NewLocksIndex = PreviousSnapshot.IsValid()
+			? MakeShared<const FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe>(*PreviousSnapshot->LocksIndex, MoveTemp(InLocks))
+			: MakeShared<const FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe>(FPlasticSourceControlLocksIndex(), MoveTemp(InLocks));
+		const FLocksSnapshotRef NewSnapshot = MakeShared<const FLocksSnapshot, ESPMode::ThreadSafe>(InRepositorySpecification, InWorkingBranch, NewLocksIndex, FDateTime::Now());
+		{
+			FWriteScopeLock WriteLock(SnapshotLock);
+			Snapshot = NewSnapshot;
+		}
+		FPlatformAtomics::InterlockedExchange(&bRefreshRequested, 0);
+		FPlatformAtomics::InterlockedExchange(&bUsedSinceUpdate, 0);
+
+		const FPlasticSourceControlLocksChanges& Changes = NewLocksIndex->GetChanges();
+		UE_LOG(LogSourceControl, Verbose, TEXT("FLocksCache::UpdateLocks(%d): %d added, %d removed, %d changed"), NewLocksIndex->GetLocks().Num(), Changes.Added.Num(), Changes.Removed.Num(), Changes.Changed.Num());
+
+		return NewLocksIndex;
+	}
+
+	// Remove the locks released or removed by an unlock command, keeping the timestamp of the snapshot,
+	// and optionally request a background refresh to catch up with the locks that the server might have retained
+	// Note: only called with the FetchCriticalSection held, so there is no concurrent update
+	FPlasticSourceControlLocksIndexPtr RemoveLocks(const TArray<FPlasticSourceControlLockRef>& InUnlockedLocks, const bool bInRequestRefresh)
+	{
+		const FLocksSnapshotPtr PreviousSnapshot = GetSnapshot();
+		if (!PreviousSnapshot.IsValid())
+		{
+			return nullptr;
+		}
+
+		const FPlasticSourceControlLocksIndexRef NewLocksIndex = MakeShared<const FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe>(*PreviousSnapshot->LocksIndex, InUnlockedLocks);
+		const FLocksSnapshotRef NewSnapshot = MakeShared<const FLocksSnapshot, ESPMode::ThreadSafe>(PreviousSnapshot->RepositorySpecification, PreviousSnapshot->WorkingBranch, NewLocksIndex, PreviousSnapshot->Timestamp);
+		{
+			FWriteScopeLock WriteLock(SnapshotLock);
+			Snapshot = NewSnapshot;
+		}
+		if (bInRequestRefresh)
+		{
+			FPlatformAtomics::InterlockedExchange(&bRefreshRequested, 1);
+		}
+
+		UE_LOG(LogSourceControl, Verbose, TEXT("FLocksCache::RemoveLocks(%d): %d removed"), NewLocksIndex->GetLocks().Num(), NewLocksIndex->GetChanges().Removed.Num());
+
+		return NewLocksIndex;
+	}
+
+	// Get the locks if not expired, or expired for less than the maximum staleness, in which case a background refresh is requested
+	bool GetLocks(const FString& InRepositorySpecification, const FString& InWorkingBranch, FPlasticSourceControlLocksIndexPtr& OutLocksIndex)
+	{
+		const FLocksSnapshotPtr CurrentSnapshot = GetSnapshot(InRepositorySpecification, InWorkingBranch);
+		if (!CurrentSnapshot.IsValid())
+		{
+			return false;
+		}
+
+		const UPlasticSourceControlProjectSettings* Settings = GetDefault<UPlasticSourceControlProjectSettings>();
+		const double ElapsedMinutes = (FDateTime::Now() - CurrentSnapshot->Timestamp).GetTotalMinutes();
+		if (ElapsedMinutes < Settings->LocksCacheExpirationDelayMinutes)
+		{
+			UE_LOG(LogSourceControl, Verbose, TEXT("FLocksCache::GetLocks(%d)"), CurrentSnapshot->LocksIndex->GetLocks().Num());
+		}
+		else if (ElapsedMinutes < FMath::Max(Settings->LocksCacheMaxStalenessMinutes, Settings->LocksCacheExpirationDelayMinutes))
+		{
+			UE_LOG(LogSourceControl, Verbose, TEXT("FLocksCache::GetLocks(%d): expired since %.1f min, refreshing in the background"), CurrentSnapshot->LocksIndex->GetLocks().Num(), ElapsedMinutes - Settings->LocksCacheExpirationDelayMinutes);
+			FPlatformAtomics::InterlockedExchange(&bRefreshRequested, 1);
+		}
+		else
+		{
+			return false;
+		}
+
+		FPlatformAtomics::InterlockedExchange(&bUsedSinceUpdate, 1);
+		OutLocksIndex = CurrentSnapshot->LocksIndex;
+		return true;
 	}
 
-	void SetLocks(const TArray<FPlasticSourceControlLockRef>& InLocks)
+	// Get the locks only if they are not expired, typically after waiting for another thread to update them
+	bool GetFreshLocks(const FString& InRepositorySpecification, const FString& InWorkingBranch, FPlasticSourceControlLocksIndexPtr& OutLocksIndex)
 	{
-		Locks = InLocks;
-		Timestamp = FDateTime::Now();
+		const FLocksSnapshotPtr CurrentSnapshot = GetSnapshot(InRepositorySpecification, InWorkingBranch);
+		if (CurrentSnapshot.IsValid() && ((FDateTime::Now() - CurrentSnapshot->Timestamp).GetTotalMinutes() < GetDefault<UPlasticSourceControlProjectSettings>()->LocksCacheExpirationDelayMinutes))
+		{
+			OutLocksIndex = CurrentSnapshot->LocksIndex;
+			return true;
+		}
+		return false;
 	}
 
-	bool GetLocks(TArray<FPlasticSourceControlLockRef>& OutLocks)
+	// Start a background refresh if requested by a stale read, or shortly before the expiration of locks in use if the Editor is idle
+	// Note: only called from the game thread
+	bool StartRefresh(const FString& InRepositorySpecification, const FString& InWorkingBranch, const bool bInIsIdle)
 	{
-		const FTimespan ElapsedTime = FDateTime::Now() - Timestamp;
-		if (ElapsedTime.GetTotalMinutes() < GetDefault<UPlasticSourceControlProjectSettings>()->LocksCacheExpirationDelayMinutes)
+		const FLocksSnapshotPtr CurrentSnapshot = GetSnapshot(InRepositorySpecification, InWorkingBranch);
+		// Note: don't retry a failed refresh right away, the server is probably unreachable
+		if (bRefreshInProgress || !CurrentSnapshot.IsValid() || ((FDateTime::Now() - LastRefreshTimestamp).GetTotalSeconds() < LocksCacheRefreshAheadSeconds))
 		{
-			UE_LOG(LogSourceControl, Verbose, TEXT("FLocksCache::GetLocks(%d)"), Locks.Num());
-			OutLocks = Locks;
+			return false;
+		}
+
+		const double ElapsedSeconds = (FDateTime::Now() - CurrentSnapshot->Timestamp).GetTotalSeconds();
+		const double ExpirationSeconds = GetDefault<UPlasticSourceControlProjectSettings>()->LocksCacheExpirationDelayMinutes * 60.0;
+		if (bRefreshRequested || (bInIsIdle && bUsedSinceUpdate && (ElapsedSeconds > ExpirationSeconds - LocksCacheRefreshAheadSeconds)))
+		{
+			FPlatformAtomics::InterlockedExchange(&bRefreshInProgress, 1);
+			LastRefreshTimestamp = FDateTime::Now();
 			return true;
 		}
 		return false;
 	}
 
+	void EndRefresh()
+	{
+		FPlatformAtomics::InterlockedExchange(&bRefreshInProgress, 0);
+	}
+
 public:
-	FCriticalSection CriticalSection;
+	// Serialize the lock list commands, held for their whole duration
+	FCriticalSection FetchCriticalSection;
+
+	// Background refresh started by TickLocksCache(), waited for by Reset()
+	// Note: only accessed from the game thread
+	TFuture<void> RefreshFuture;
 
 private:
-	TArray<FPlasticSourceControlLockRef> Locks;
-	FDateTime Timestamp;
+	FLocksSnapshotPtr GetSnapshot() const
+	{
+		FReadScopeLock ReadLock(SnapshotLock);
+		return Snapshot;
+	}
+
+	// Get the current snapshot only if it is for this repository and this working branch
+	FLocksSnapshotPtr GetSnapshot(const FString& InRepositorySpecification, const FString& InWorkingBranch) const
+	{
+		FLocksSnapshotPtr CurrentSnapshot = GetSnapshot();
+		if (CurrentSnapshot.IsValid() && ((CurrentSnapshot->RepositorySpecification != InRepositorySpecification) || (CurrentSnapshot->WorkingBranch != InWorkingBranch)))
+		{
+			CurrentSnapshot.Reset();
+		}
+		return CurrentSnapshot;
+	}
+
+	// Only held to copy or swap the shared pointers to the snapshots
+	mutable FRWLock SnapshotLock;
+	FLocksSnapshotPtr Snapshot;
+
+	// Flags shared between the readers and the background refresh
+	volatile int32 bRefreshRequested = 0;
+	volatile int32 bRefreshInProgress = 0;
+	volatile int32 bUsedSinceUpdate = 0;
+
+	// Only accessed from the game thread
+	FDateTime LastRefreshTimestamp;
 };
 
+// Locks for all destination branches, and locks applying only to the working branch, as filtered by the server
 static FLocksCache LocksCacheForAllDestBranches;
 static FLocksCache LocksCacheForWorkingBranch;
 
+// Server paths of the locks that changed since the last call to UpdateCachedLocks(), with the index to get their new locks from.
+static FCriticalSection ChangedLockPathsCriticalSection;
+static TSet<FString> ChangedLockPaths;
+static FPlasticSourceControlLocksIndexPtr ChangedLocksIndex;
+
 void InvalidateLocksCache()
 {
 	UE_LOG(LogSourceControl, Verbose, TEXT("InvalidateLocksCache()"));
-	LocksCacheForAllDestBranches.Reset();
-	LocksCacheForWorkingBranch.Reset();
+	LocksCacheForAllDestBranches.Invalidate();
+	LocksCacheForWorkingBranch.Invalidate();
 }
 
-bool RunListLocks(const FPlasticSourceControlProvider& InProvider, const bool bInForAllDestBranches, TArray<FPlasticSourceControlLockRef>& OutLocks)
+// Record the paths of the files whose states might need to be updated, see UpdateCachedLocks()
+static void RecordLocksChanges(const FPlasticSourceControlLocksIndexRef& InLocksIndex)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::RunListLocks);
+	const FPlasticSourceControlLocksChanges& Changes = InLocksIndex->GetChanges();
+	if (Changes.IsEmpty())
+		return;
 
-	FLocksCache& LocksCache = bInForAllDestBranches ? LocksCacheForAllDestBranches : LocksCacheForWorkingBranch;
+	FScopeLock ChangedLockPathsLock(&ChangedLockPathsCriticalSection);
+	for (const TArray<FPlasticSourceControlLockRef>* ChangedLocks : { &Changes.Added, &Changes.Removed, &Changes.Changed })
+	{
+		for (const FPlasticSourceControlLockRef& Lock : *ChangedLocks)
+		{
+			if (!Lock->Path.IsEmpty())
+			{
+				ChangedLockPaths.Add(Lock->Path);
+			}
+		}
+	}
+	ChangedLocksIndex = InLocksIndex;
+}
+
+// For displaying Locks as a status overlay icon in the Content Browser, restricts the Locks to only those applying to the current branch so there can be only one and never any ambiguity
+// Note: returns an empty branch name for all destination branches, or if the server doesn't support 'lock list --workingbranch'
+static FString GetLocksWorkingBranch(const FPlasticSourceControlProvider& InProvider, const bool bInForAllDestBranches)
+{
+	if (!bInForAllDestBranches && (InProvider.GetPlasticScmVersion() >= PlasticSourceControlVersions::WorkingBranch))
+	{
+		// Note: here is one of the rare places where we need to use a branch name, not a workspace selector
+		return InProvider.GetBranchName();
+	}
+	return FString();
+}
+
+/**
+ * Run a "lock list" command and update the cache with the new locks.
+ *
+ * @param	InRepositorySpecification	Repository to list the locks of
+ * @param	InWorkingBranch				Branch to restrict the locks to with --workingbranch, or empty for all destination branches, see GetLocksWorkingBranch()
+ * @param	InLocksCache				Cache of the locks for all destination branches or for the working branch
+ * @param	bInForceRefresh				Run the command even if another thread just updated the cache, for a background refresh ahead of its expiration
+ */
+static bool FetchLocks(const FString& InRepositorySpecification, const FString& InWorkingBranch, FLocksCache& InLocksCache, const bool bInForceRefresh, FPlasticSourceControlLocksIndexPtr& OutLocksIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::FetchLocks);
 
-	FScopeLock ScopeLock(&LocksCache.CriticalSection);
+	FScopeLock FetchLock(&InLocksCache.FetchCriticalSection);
 
-	if (LocksCache.GetLocks(OutLocks))
+	if (!bInForceRefresh && InLocksCache.GetFreshLocks(InRepositorySpecification, InWorkingBranch, OutLocksIndex))
 		return true;
 
 	TArray<FString> Results;
@@ -549,58 +839,148 @@ bool RunListLocks(const FPlasticSourceControlProvider& InProvider, const bool bI
 	Parameters.Add(TEXT("list"));
 	Parameters.Add(TEXT("--machinereadable"));
 	Parameters.Add(TEXT("--smartlocks"));
-	Parameters.Add(FString::Printf(TEXT("--repository=\"%s\""), *InProvider.GetRepositorySpecification()));
+	Parameters.Add(FString::Printf(TEXT("--repository=\"%s\""), *InRepositorySpecification));
 	Parameters.Add(TEXT("--anystatus"));
 	Parameters.Add(TEXT("--fieldseparator=\"") FILE_STATUS_SEPARATOR TEXT("\""));
 	// NOTE: --dateformat was added to smartlocks a couple of releases later in version 11.0.16.8133
 	Parameters.Add(TEXT("--dateformat=yyyy-MM-ddTHH:mm:ss"));
-	// For displaying Locks as a status overlay icon in the Content Browser, restricts the Locks to only those applying to the current branch so there can be only one and never any ambiguity
-	if (!bInForAllDestBranches && (InProvider.GetPlasticScmVersion() >= PlasticSourceControlVersions::WorkingBranch))
+	if (!InWorkingBranch.IsEmpty())
 	{
-		// Note: here is one of the rare places where we need to use a branch name, not a workspace selector
-		Parameters.Add(FString::Printf(TEXT("--workingbranch=\"%s\""), *InProvider.GetBranchName()));
+		Parameters.Add(FString::Printf(TEXT("--workingbranch=\"%s\""), *InWorkingBranch));
 	}
 	const bool bResult = RunCommand(TEXT("lock"), Parameters, TArray<FString>(), Results, ErrorMessages);
 
 	if (bResult)
 	{
-		OutLocks.Reserve(Results.Num());
+		TArray<FPlasticSourceControlLock> Locks;
+		Locks.Reserve(Results.Num());
 		for (int32 IdxResult = 0; IdxResult < Results.Num(); IdxResult++)
 		{
 			const FString& Result = Results[IdxResult];
-			FPlasticSourceControlLock&& Lock = PlasticSourceControlParsers::ParseLockInfo(Result);
-			OutLocks.Add(MakeShareable(new FPlasticSourceControlLock(Lock)));
+			Locks.Add(PlasticSourceControlParsers::ParseLockInfo(Result));
 		}
 
-		LocksCache.SetLocks(OutLocks);
+		const FPlasticSourceControlLocksIndexRef LocksIndex = InLocksCache.UpdateLocks(InRepositorySpecification, InWorkingBranch, MoveTemp(Locks));
+		OutLocksIndex = LocksIndex;
 
-		UE_LOG(LogSourceControl, Verbose, TEXT("RunListLocks: %d locks"), OutLocks.Num());
+		// Locks of the working branch are the ones shown in the states of the files
+		if (&InLocksCache == &LocksCacheForWorkingBranch)
+		{
+			RecordLocksChanges(LocksIndex);
+		}
 	}
 
 	return bResult;
 }
 
+bool RunListLocks(const FPlasticSourceControlProvider& InProvider, const bool bInForAllDestBranches, FPlasticSourceControlLocksIndexPtr& OutLocksIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::RunListLocks);
+
+	FLocksCache& LocksCache = bInForAllDestBranches ? LocksCacheForAllDestBranches : LocksCacheForWorkingBranch;
+	const FString RepositorySpecification = InProvider.GetRepositorySpecification();
+	const FString WorkingBranch = GetLocksWorkingBranch(InProvider, bInForAllDestBranches);
+	if (LocksCache.GetLocks(RepositorySpecification, WorkingBranch, OutLocksIndex))
+		return true;
+
+	const bool bForceRefresh = false;
+	return FetchLocks(RepositorySpecification, WorkingBranch, LocksCache, bForceRefresh, OutLocksIndex);
+}
+
+void TickLocksCache(const FPlasticSourceControlProvider& InProvider, const bool bInIsIdle)
+{
+	const FString RepositorySpecification = InProvider.GetRepositorySpecification();
+	for (const bool bForAllDestBranches : { true, false })
+	{
+		FLocksCache& LocksCache = bForAllDestBranches ? LocksCacheForAllDestBranches : LocksCacheForWorkingBranch;
+		const FString WorkingBranch = GetLocksWorkingBranch(InProvider, bForAllDestBranches);
+		if (!LocksCache.StartRefresh(RepositorySpecification, WorkingBranch, bInIsIdle))
+		{
+			continue;
+		}
+
+		UE_LOG(LogSourceControl, Verbose, TEXT("TickLocksCache: refreshing the locks of %s%s in the background"), *RepositorySpecification, bForAllDestBranches ? TEXT(" for all destination branches") : TEXT(""));
+		LocksCache.RefreshFuture = Async(EAsyncExecution::ThreadPool, [&LocksCache, RepositorySpecification, WorkingBranch]()
+		{
+			const bool bForceRefresh = true;
+			FPlasticSourceControlLocksIndexPtr LocksIndex;
+			FetchLocks(RepositorySpecification, WorkingBranch, LocksCache, bForceRefresh, LocksIndex);
+			LocksCache.EndRefresh();
+		});
+	}
+}
+
+void ResetLocksCache()
+{
+	LocksCacheForAllDestBranches.Reset();
+	LocksCacheForWorkingBranch.Reset();
+
+	FScopeLock ChangedLockPathsLock(&ChangedLockPathsCriticalSection);
+	ChangedLockPaths.Empty();
+	ChangedLocksIndex.Reset();
+}
+
+void RemoveCachedLocks(const TArray<FPlasticSourceControlLockRef>& InUnlockedLocks, const bool bInRemoved)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::RemoveCachedLocks);
+
+	// Note: released locks might be retained by the server, eg if their item was changed on their branch, so only removed locks are known for sure
+	const bool bRequestRefresh = !bInRemoved;
+	for (const bool bForAllDestBranches : { true, false })
+	{
+		FLocksCache& LocksCache = bForAllDestBranches ? LocksCacheForAllDestBranches : LocksCacheForWorkingBranch;
+		FScopeLock FetchLock(&LocksCache.FetchCriticalSection);
+		const FPlasticSourceControlLocksIndexPtr LocksIndex = LocksCache.RemoveLocks(InUnlockedLocks, bRequestRefresh);
+		// Locks of the working branch are the ones shown in the states of the files
+		if (!bForAllDestBranches && LocksIndex.IsValid())
+		{
+			RecordLocksChanges(LocksIndex.ToSharedRef());
+		}
+	}
+}
+
+TArray<TArray<FPlasticSourceControlLockRef>> BatchLocksToUnlock(const TArray<FPlasticSourceControlLockRef>& InLocks, const int32 InMaxBatchSize)
+{
+	// Group the locks by destination branch and branch, keeping them in their original order
+	TMap<TPair<FString, FString>, TArray<FPlasticSourceControlLockRef>> LocksByBranches;
+	for (const FPlasticSourceControlLockRef& Lock : InLocks)
+	{
+		LocksByBranches.FindOrAdd(TPair<FString, FString>(Lock->DestinationBranch, Lock->Branch)).Add(Lock);
+	}
+
+	TArray<TArray<FPlasticSourceControlLockRef>> Batches;
+	for (const TPair<TPair<FString, FString>, TArray<FPlasticSourceControlLockRef>>& BranchesLocks : LocksByBranches)
+	{
+		const TArray<FPlasticSourceControlLockRef>& Locks = BranchesLocks.Value;
+		for (int32 FirstLockIndex = 0; FirstLockIndex < Locks.Num(); FirstLockIndex += InMaxBatchSize)
+		{
+			const int32 NumLocks = FMath::Min(InMaxBatchSize, Locks.Num() - FirstLockIndex);
+			Batches.Emplace(Locks.GetData() + FirstLockIndex, NumLocks);
+		}
+	}
+	return Batches;
+}
+
 TArray<FPlasticSourceControlLockRef> GetLocksForWorkingBranch(const FPlasticSourceControlProvider& InProvider, const TArray<FString>& InFiles)
 {
-	TArray<FPlasticSourceControlLockRef> Locks;
+	TArray<FPlasticSourceControlLockRef> MatchingLocks;
 
 	// Only get locks for the current working branch
 	const bool bInForAllDestBranches = false;
-	RunListLocks(InProvider, bInForAllDestBranches, Locks);
+	FPlasticSourceControlLocksIndexPtr LocksIndex;
+	if (!RunListLocks(InProvider, bInForAllDestBranches, LocksIndex))
+	{
+		return MatchingLocks;
+	}
 
-	TArray<FPlasticSourceControlLockRef> MatchingLocks;
 	MatchingLocks.Reserve(InFiles.Num());
 
 	// Only return locks for the specified files
 	for (const FString& File : InFiles)
 	{
-		for (const FPlasticSourceControlLockRef& Lock : Locks)
+		if (FPlasticSourceControlLockPtr Lock = LocksIndex->FindByFilename(File))
 		{
-			if (File.EndsWith(Lock->Path))
-			{
-				MatchingLocks.Add(Lock);
-				break;
-			}
+			MatchingLocks.Add(Lock.ToSharedRef());
 		}
 	}
 
@@ -951,12 +1331,10 @@ bool RunGetFile(const FString& InRevSpec, const FString& InDumpFileName)
 	return bResult;
 }
 
-// Run a Plastic "history" command and parse it's XML result.
-bool RunGetHistory(const bool bInUpdateHistory, TArray<FPlasticSourceControlState>& InOutStates, TArray<FString>& OutErrorMessages)
+// Run a Plastic "history" command on some files and parse it's XML result, up to a number of revisions (0 for no limit)
+// bInFullHistory: if the limit is the one of the full history (LimitNumberOfRevisionsInHistory), so that no more revisions are to be loaded on demand
+static bool RunHistory(const bool bInUpdateHistory, const int32 InHistoryLimit, const bool bInFullHistory, const TArray<FString>& InFiles, TArray<FPlasticSourceControlState>& InOutStates, TArray<FString>& OutErrorMessages)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::RunGetHistory);
-
-	bool bResult = true;
 	FString Results;
 	FString Errors;
 	TArray<FString> Parameters;
@@ -965,16 +1343,16 @@ bool RunGetHistory(const bool bInUpdateHistory, TArray<FPlasticSourceControlStat
 	{
 		Parameters.Add(TEXT("--moveddeleted"));
 	}
-	const FScopedTempFile HistoryResultFile(TEXT("History-"), TEXT(".xml"));
-	Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *HistoryResultFile.GetFilename()));
+	const FXmlResultOutput HistoryResultOutput(TEXT("History-"));
+	Parameters.Add(HistoryResultOutput.GetParameter());
 	Parameters.Add(TEXT("--encoding=\"utf-8\""));
 	const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
 	if (Provider.GetPlasticScmVersion() >= PlasticSourceControlVersions::NewHistoryLimit)
 	{
 		if (bInUpdateHistory)
 		{
-			// --limit=0 will not limit the number of revisions, as stated by LimitNumberOfRevisionsInHistory
-			Parameters.Add(FString::Printf(TEXT("--limit=%d"), GetDefault<UPlasticSourceControlProjectSettings>()->LimitNumberOfRevisionsInHistory));
+			// --limit=0 will not limit the number of revisions
+			Parameters.Add(FString::Printf(TEXT("--limit=%d"), InHistoryLimit));
 		}
 		else
 		{
@@ -983,6 +1361,53 @@ bool RunGetHistory(const bool bInUpdateHistory, TArray<FPlasticSourceControlStat
 		}
 	}
 
+	bool bResult = RunCommand(TEXT("history"), Parameters, InFiles, Results, Errors);
+	if (bResult)
+	{
+		bResult = HistoryResultOutput.Load(Results) && PlasticSourceControlParsers::ParseHistoryResults(bInUpdateHistory, bInFullHistory ? 0 : InHistoryLimit, MoveTemp(Results), InOutStates);
+	}
+	if (!Errors.IsEmpty())
+	{
+		OutErrorMessages.Add(MoveTemp(Errors));
+	}
+
+	return bResult;
+}
+
+static bool HasHistoryRevision(const FPlasticSourceControlState& InState, const int32 InChangesetNumber)
+{
+	return (InChangesetNumber <= 0) || InState.History.ContainsByPredicate([InChangesetNumber](const TSharedRef<FPlasticSourceControlRevision, ESPMode::ThreadSafe>& InRevision)
+	{
+		return InRevision->ChangesetNumber == InChangesetNumber;
+	});
+}
+
+// Check that a page of the history contains the revisions looked up by the status, merge and diff operations: the current one, and the base and source of a merge
+static bool HasRequiredHistoryRevisions(const FPlasticSourceControlState& InState)
+{
+	if (InState.bHistoryComplete)
+	{
+		return true;
+	}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const int32 MergeBaseChangeset = InState.PendingResolveInfo.BaseRevision.IsEmpty() ? ISourceControlState::INVALID_REVISION : FCString::Atoi(*InState.PendingResolveInfo.BaseRevision);
+	const int32 MergeSourceChangeset = InState.PendingResolveInfo.RemoteRevision.IsEmpty() ? ISourceControlState::INVALID_REVISION : FCString::Atoi(*InState.PendingResolveInfo.RemoteRevision);
+#else
+	const int32 MergeBaseChangeset = InState.PendingMergeBaseChangeset;
+	const int32 MergeSourceChangeset = InState.PendingMergeSourceChangeset;
+#endif
+
+	return HasHistoryRevision(InState, InState.LocalRevisionChangeset)
+		&& HasHistoryRevision(InState, MergeBaseChangeset)
+		&& HasHistoryRevision(InState, MergeSourceChangeset);
+}
+
+// Run a Plastic "history" command and parse it's XML result.
+bool RunGetHistory(const bool bInUpdateHistory, TArray<FPlasticSourceControlState>& InOutStates, TArray<FString>& OutErrorMessages, const int32 InHistoryLimit /* = 0 */)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::RunGetHistory);
+
 	TArray<FString> Files;
 	Files.Reserve(InOutStates.Num());
 	for (const FPlasticSourceControlState& State : InOutStates)
@@ -996,16 +1421,45 @@ bool RunGetHistory(const bool bInUpdateHistory, TArray<FPlasticSourceControlStat
 			Files.Add(State.LocalFilename);
 		}
 	}
-	if (Files.Num() > 0)
+	if (Files.Num() == 0)
 	{
-		bResult = RunCommand(TEXT("history"), Parameters, Files, Results, Errors);
-		if (bResult)
+		return true;
+	}
+
+	// LimitNumberOfRevisionsInHistory=0 will not limit the number of revisions, as with older versions not supporting the limit
+	const UPlasticSourceControlProjectSettings* Settings = GetDefault<UPlasticSourceControlProjectSettings>();
+	const bool bSupportsLimit = FPlasticSourceControlModule::Get().GetProvider().GetPlasticScmVersion() >= PlasticSourceControlVersions::NewHistoryLimit;
+	const int32 FullHistoryLimit = bSupportsLimit ? Settings->LimitNumberOfRevisionsInHistory : 0;
+	int32 HistoryLimit = FullHistoryLimit;
+	if (bInUpdateHistory && bSupportsLimit && (InHistoryLimit != INDEX_NONE))
+	{
+		// Load only a first page of the history of a large selection, so that the History window is interactive right away,
+		// the next ones being loaded on demand, while a single file gets its full history, as needed by diffs and merges
+		const int32 PageLimit = (InHistoryLimit > 0) ? InHistoryLimit : ((Files.Num() > 1) ? Settings->HistoryPageSize : 0);
+		if ((PageLimit > 0) && ((FullHistoryLimit == 0) || (PageLimit < FullHistoryLimit)))
 		{
-			bResult = PlasticSourceControlParsers::ParseHistoryResults(bInUpdateHistory, HistoryResultFile.GetFilename(), InOutStates);
+			HistoryLimit = PageLimit;
 		}
-		if (!Errors.IsEmpty())
+	}
+
+	bool bResult = RunHistory(bInUpdateHistory, HistoryLimit, HistoryLimit == FullHistoryLimit, Files, InOutStates, OutErrorMessages);
+
+	if (bResult && bInUpdateHistory && (HistoryLimit != FullHistoryLimit))
+	{
+		// The revisions looked up by the status, merge and diff operations must not be missing from the first page: load the full history of these files
+		TArray<FString> FilesMissingRevisions;
+		for (FPlasticSourceControlState& State : InOutStates)
+		{
+			if (State.IsSourceControlled() && !State.IsAdded() && !HasRequiredHistoryRevisions(State))
+			{
+				State.History.Empty();
+				FilesMissingRevisions.Add(State.LocalFilename);
+			}
+		}
+		if (FilesMissingRevisions.Num() > 0)
 		{
-			OutErrorMessages.Add(MoveTemp(Errors));
+			UE_LOG(LogSourceControl, Verbose, TEXT("RunGetHistory: full history of %d/%d files missing required revisions in their first page"), FilesMissingRevisions.Num(), Files.Num());
+			bResult = RunHistory(bInUpdateHistory, FullHistoryLimit, true, FilesMissingRevisions, InOutStates, OutErrorMessages);
 		}
 	}
 
@@ -1022,8 +1476,9 @@ bool RunUpdate(const TArray<FString>& InFiles, const bool bInIsPartialWorkspace,
 	// Detect special case for a partial checkout (CS:-1 in Gluon mode)!
 	if (!bInIsPartialWorkspace)
 	{
-		const FScopedTempFile UpdateResultFile(TEXT("Update-"), TEXT(".xml"));
-		TArray<FString> InfoMessages;
+		const FXmlResultOutput UpdateResultOutput(TEXT("Update-"));
+		FString Results;
+		FString Errors;
 		if (!InChangesetId.IsEmpty())
 		{
 			Parameters.Add(FString::Printf(TEXT("--changeset=%s"), *InChangesetId));
@@ -1034,18 +1489,21 @@ bool RunUpdate(const TArray<FString>& InFiles, const bool bInIsPartialWorkspace,
 		}
 		Parameters.Add(TEXT("--dontmerge"));
 		Parameters.Add(TEXT("--noinput"));
-		Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *UpdateResultFile.GetFilename()));
+		Parameters.Add(UpdateResultOutput.GetParameter());
 		Parameters.Add(TEXT("--encoding=\"utf-8\""));
-		bResult = PlasticSourceControlUtils::RunCommand(TEXT("update"), Parameters, TArray<FString>(), InfoMessages, OutErrorMessages);
+		bResult = PlasticSourceControlUtils::RunCommand(TEXT("update"), Parameters, TArray<FString>(), Results, Errors);
 		if (bResult)
 		{
 			// Load and parse the result of the update command
-			FString Results;
-			if (FFileHelper::LoadFileToString(Results, *UpdateResultFile.GetFilename()))
+			if (UpdateResultOutput.Load(Results))
 			{
-				bResult = PlasticSourceControlParsers::ParseUpdateResults(Results, OutUpdatedFiles);
+				bResult = PlasticSourceControlParsers::ParseUpdateResults(MoveTemp(Results), OutUpdatedFiles);
 			}
 		}
+		if (!Errors.IsEmpty())
+		{
+			AppendErrorMessages(Errors, OutErrorMessages);
+		}
 	}
 	else
 	{
@@ -1077,7 +1535,7 @@ bool RunGetChangelists(TArray<FPlasticSourceControlChangelistState>& OutChangeli
 
 	FString Results;
 	FString Errors;
-	const FScopedTempFile GetChangelistFile(TEXT("StatusChangelist-"), TEXT(".xml"));
+	const FXmlResultOutput ChangelistResultOutput(TEXT("StatusChangelist-"));
 	TArray<FString> Parameters;
 	Parameters.Add(TEXT("--changelists"));
 	Parameters.Add(TEXT("--controlledchanged"));
@@ -1098,12 +1556,12 @@ bool RunGetChangelists(TArray<FPlasticSourceControlChangelistState>& OutChangeli
 	}
 
 	Parameters.Add(TEXT("--noheader"));
-	Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *GetChangelistFile.GetFilename()));
+	Parameters.Add(ChangelistResultOutput.GetParameter());
 	Parameters.Add(TEXT("--encoding=\"utf-8\""));
 	bool bResult = RunCommand(TEXT("status"), Parameters, TArray<FString>(), Results, Errors);
 	if (bResult)
 	{
-		bResult = PlasticSourceControlParsers::ParseChangelistsResults(GetChangelistFile.GetFilename(), OutChangelistsStates, OutCLFilesStates);
+		bResult = ChangelistResultOutput.Load(Results) && PlasticSourceControlParsers::ParseChangelistsResults(MoveTemp(Results), OutChangelistsStates, OutCLFilesStates);
 	}
 	if (!Errors.IsEmpty())
 	{
@@ -1126,7 +1584,10 @@ void AddShelvedFileToChangelist(FPlasticSourceControlChangelistState& InOutChang
 		SourceControlRevision->Filename = ShelveState->GetFilename();
 		SourceControlRevision->ShelveId = InOutChangelistsState.ShelveId;
 		SourceControlRevision->ChangesetNumber = InOutChangelistsState.ShelveId; // Note: for display in the diff window only
-		SourceControlRevision->Date = InOutChangelistsState.ShelveDate; // Note: not yet used for display as of UE5.2
+		// Note: shelves are not changesets, so their metadata is not shared through the table
+		const TSharedRef<FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe> ShelveMetadata = MakeShared<FPlasticSourceControlChangesetMetadata, ESPMode::ThreadSafe>();
+		ShelveMetadata->Date = InOutChangelistsState.ShelveDate; // Note: not yet used for display as of UE5.2
+		SourceControlRevision->ChangesetMetadata = ShelveMetadata;
 
 		ShelveState->History.Add(SourceControlRevision);
 	}
@@ -1181,14 +1642,15 @@ bool RunGetShelves(TArray<FPlasticSourceControlChangelistState>& InOutChangelist
 {
 	bool bCommandSuccessful;
 
+	const FXmlResultOutput ShelveResultOutput(TEXT("FindShelves-"));
 	FString Results;
 	FString Errors;
 	TArray<FString> Parameters;
 	Parameters.Add(TEXT("\"shelves where owner = 'me'\""));
-	Parameters.Add(TEXT("--xml")); // TODO convert to -xml=<FScopedTempFile>
+	Parameters.Add(ShelveResultOutput.GetParameter());
 	Parameters.Add(TEXT("--encoding=\"utf-8\""));
 	bCommandSuccessful = PlasticSourceControlUtils::RunCommand(TEXT("find"), Parameters, TArray<FString>(), Results, Errors);
-	if (bCommandSuccessful)
+	if (bCommandSuccessful && ShelveResultOutput.Load(Results))
 	{
 		bCommandSuccessful = PlasticSourceControlParsers::ParseShelvesResults(Results, InOutChangelistsStates);
 		if (bCommandSuccessful)
@@ -1236,14 +1698,15 @@ bool RunGetShelve(const int32 InShelveId, FString& OutComment, FDateTime& OutDat
 {
 	bool bCommandSuccessful;
 
+	const FXmlResultOutput ShelveResultOutput(TEXT("FindShelve-"));
 	FString Results;
 	FString Errors;
 	TArray<FString> Parameters;
 	Parameters.Add(FString::Printf(TEXT("\"shelves where ShelveId = %d\""), InShelveId));
-	Parameters.Add(TEXT("--xml")); // TODO convert to -xml=<FScopedTempFile>
+	Parameters.Add(ShelveResultOutput.GetParameter());
 	Parameters.Add(TEXT("--encoding=\"utf-8\""));
 	bCommandSuccessful = PlasticSourceControlUtils::RunCommand(TEXT("find"), Parameters, TArray<FString>(), Results, Errors);
-	if (bCommandSuccessful)
+	if (bCommandSuccessful && ShelveResultOutput.Load(Results))
 	{
 		bCommandSuccessful = PlasticSourceControlParsers::ParseShelvesResult(Results, OutComment, OutDate, OutOwner);
 		if (bCommandSuccessful)
@@ -1261,31 +1724,627 @@ bool RunGetShelve(const int32 InShelveId, FString& OutComment, FDateTime& OutDat
 
 #endif
 
-bool RunGetChangesets(const FDateTime& InFromDate, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, TArray<FString>& OutErrorMessages)
+// Changesets already fetched from the repository, by descending id, covering all the changesets since a date, or only the newest ones loaded by pages.
+// New changesets get ids above the highest known one, so only these are queried in full on the next refresh, see UpdateChangesetsCache().
+// Known changesets can still change: their comment can be edited, they can be deleted, and their branch can be renamed or deleted,
+// so a bounded window of them is queried again on each refresh, in turn, and the branches are checked every few minutes.
+// Saved to disk after each update, so that the next editor sessions start from there, see PlasticSourceControlHistoryCache
+class FChangesetsCache
 {
-	bool bCommandSuccessful = false;
+public:
+	// Held for the whole update of the cache, by the thread running the command
+	FCriticalSection CriticalSection;
+	// Held to modify the repository, the date and the changesets below, with CriticalSection, and to read them without it, see GetCachedChangesets(),
+	// so that reading the cache never waits for the cm commands of an update
+	FRWLock DataLock;
+
+	FString RepositorySpecification;
+	FDateTime FromDate;
+	// The changesets since FromDate were only loaded up to a limit, and the next page of older ones remains to be loaded
+	bool bHasOlderChangesets = false;
+	TArray<FPlasticSourceControlChangesetRef> Changesets;
+	// Index of the next changesets to query again, so that the whole cache gets checked over a number of refreshes, see UpdateChangesetsCache()
+	int32 RevalidationIndex = 0;
+	// Branches of cached changesets that no longer existed under their name on the last check,
+	// and id below which their changesets remain to be queried again, one window per refresh
+	TSet<FString> StaleBranchNames;
+	int32 StaleBranchesBeforeId = 0;
+	// Time of the last check of the branches, see ChangesetsBranchesCheckInterval
+	double LastBranchesCheckTime = 0.0;
+};
 
-	const FScopedTempFile ChangesetResultFile(TEXT("FindChangeset-"), TEXT(".xml"));
-	TArray<FString> Results;
-	TArray<FString> Errors;
-	TArray<FString> Parameters;
-	Parameters.Add(TEXT("changesets"));
-	if (InFromDate != FDateTime())
+// Number of cached changesets queried again in one go on each refresh
+static const int32 ChangesetsRevalidationWindow = 500;
+
+// Seconds between two checks of the branches of the cached changesets, a query for each batch of branch names being too costly to run on each refresh
+static const double ChangesetsBranchesCheckInterval = 600.0;
+
+// Number of branch names in one "find branches" query, to stay well below the limits of the command line
+static const int32 BranchNamesQueryBatchSize = 100;
+
+static FChangesetsCache ChangesetsCache;
+
+// Replace the changesets of the cache, restarting their revalidation
+static void ResetChangesetsCache(FChangesetsCache& InOutCache, const FDateTime& InFromDate, const bool bInHasOlderChangesets, TArray<FPlasticSourceControlChangesetRef>&& InChangesets)
+{
 	{
-		Parameters.Add(FString::Printf(TEXT("\"where date >= '%d/%d/%d'\""), InFromDate.GetYear(), InFromDate.GetMonth(), InFromDate.GetDay()));
+		FWriteScopeLock WriteLock(InOutCache.DataLock);
+		InOutCache.FromDate = InFromDate;
+		InOutCache.bHasOlderChangesets = bInHasOlderChangesets;
+		InOutCache.Changesets = MoveTemp(InChangesets);
 	}
-	Parameters.Add(TEXT("order by ChangesetId desc"));
-	Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *ChangesetResultFile.GetFilename()));
-	Parameters.Add(TEXT("--encoding=\"utf-8\""));
-	bCommandSuccessful = PlasticSourceControlUtils::RunCommand(TEXT("find"), Parameters, TArray<FString>(), Results, Errors);
-	if (bCommandSuccessful && FPaths::FileExists(ChangesetResultFile.GetFilename()))
+	InOutCache.RevalidationIndex = 0;
+	InOutCache.StaleBranchNames.Reset();
+	InOutCache.StaleBranchesBeforeId = 0;
+}
+
+// Reset the cache to the changesets of the repository saved by a previous session, if any
+static void LoadChangesetsCache(FChangesetsCache& InOutCache, const FString& InRepositorySpecification)
+{
+	FDateTime FromDate;
+	bool bHasOlderChangesets = false;
+	TArray<FPlasticSourceControlChangesetRef> Changesets;
+	if (!PlasticSourceControlHistoryCache::LoadChangesets(PlasticSourceControlHistoryCache::GetChangesetsFilename(InRepositorySpecification), InRepositorySpecification, FromDate, bHasOlderChangesets, Changesets))
 	{
-		bCommandSuccessful = PlasticSourceControlParsers::ParseChangesetsResults(ChangesetResultFile.GetFilename(), OutChangesets);
+		FromDate = FDateTime();
+		bHasOlderChangesets = false;
+		Changesets.Reset();
 	}
-	if (Errors.Num() > 0)
 	{
-		OutErrorMessages.Append(MoveTemp(Errors));
+		// Empty the changesets along with the switch of repository, so that readers never get the changesets of another one
+		FWriteScopeLock WriteLock(InOutCache.DataLock);
+		InOutCache.RepositorySpecification = InRepositorySpecification;
+		InOutCache.Changesets.Reset();
 	}
+	ResetChangesetsCache(InOutCache, FromDate, bHasOlderChangesets, MoveTemp(Changesets));
+	InOutCache.LastBranchesCheckTime = 0.0;
+}
+
+static FDateTime GetDay(const FDateTime& InDate)
+{
+	return FDateTime(InDate.GetYear(), InDate.GetMonth(), InDate.GetDay());
+}
+
+// Check if changesets older than the cached ones remain to be loaded since a date
+static bool HasOlderChangesets(const FChangesetsCache& InCache, const FDateTime& InFromDate)
+{
+	if (InCache.Changesets.Num() == 0)
+	{
+		return false;
+	}
+	if (InFromDate < InCache.FromDate)
+	{
+		return true; // The date range got extended
+	}
+	return InCache.bHasOlderChangesets && (InCache.Changesets.Last()->Date >= GetDay(InFromDate));
+}
+
+// Get the newest cached changesets since a date, up to a limit (0 for no limit), returning true if there are more to display
+static bool GetChangesetsSince(const FChangesetsCache& InCache, const FDateTime& InFromDate, const int32 InLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+{
+	// Note: the very same changeset objects are returned by each call, so that the list views keep the rows of the ones already displayed
+	const FDateTime FromDay = GetDay(InFromDate);
+	OutChangesets.Reserve((InLimit > 0) ? FMath::Min(InLimit, InCache.Changesets.Num()) : InCache.Changesets.Num());
+	for (const FPlasticSourceControlChangesetRef& Changeset : InCache.Changesets)
+	{
+		if (Changeset->Date >= FromDay)
+		{
+			if ((InLimit > 0) && (OutChangesets.Num() == InLimit))
+			{
+				return true;
+			}
+			OutChangesets.Add(Changeset);
+		}
+	}
+	return HasOlderChangesets(InCache, InFromDate);
+}
+
+static FString FormatFromDateCondition(const FDateTime& InFromDate)
+{
+	return FString::Printf(TEXT("date >= '%d/%d/%d'"), InFromDate.GetYear(), InFromDate.GetMonth(), InFromDate.GetDay());
+}
+
+// Condition for the changesets since a date older than a given one, to query them by pages keyed on the lowest id known rather than on an offset
+static FString FormatOlderChangesetsCondition(const FDateTime& InFromDate, const int32 InBeforeChangesetId)
+{
+	const FString Condition = FString::Printf(TEXT("changesetid < %d"), InBeforeChangesetId);
+	return (InFromDate != FDateTime()) ? FormatFromDateCondition(InFromDate) + TEXT(" and ") + Condition : Condition;
+}
+
+// Run a "find --format" command, keeping the empty lines of the results since they can be part of multi-line comments, see ParseChangesetsResults()
+static bool RunFindFormatCommand(const TArray<FString>& InParameters, TArray<FString>& OutResults, TArray<FString>& OutErrorMessages)
+{
+	FString Results;
+	FString Errors;
+	const bool bResult = PlasticSourceControlUtils::RunCommand(TEXT("find"), InParameters, TArray<FString>(), Results, Errors);
+
+	Results.ParseIntoArray(OutResults, PlasticSourceControlShell::pchDelim, false); // Don't cull empty lines
+	// but remove the empty line(s) after the last end of line
+	while ((OutResults.Num() > 0) && OutResults.Last().IsEmpty())
+	{
+		OutResults.Pop();
+	}
+	if (!Errors.IsEmpty())
+	{
+		TArray<FString> ParsedErrors;
+		Errors.ParseIntoArray(ParsedErrors, PlasticSourceControlShell::pchDelim, true);
+		OutErrorMessages.Append(MoveTemp(ParsedErrors));
+	}
+
+	return bResult;
+}
+
+// Run a "find changesets" command with the compact format, appending the results by descending id, up to a limit (0 for no limit)
+static bool FindChangesets(const FString& InCondition, const int32 InLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, TArray<FString>& OutErrorMessages)
+{
+	TArray<FString> Parameters;
+	Parameters.Add(TEXT("changesets"));
+	if (!InCondition.IsEmpty())
+	{
+		Parameters.Add(FString::Printf(TEXT("\"where %s\""), *InCondition));
+	}
+	Parameters.Add(TEXT("order by ChangesetId desc"));
+	if (InLimit > 0)
+	{
+		Parameters.Add(FString::Printf(TEXT("limit %d"), InLimit));
+	}
+	Parameters.Add(TEXT("--format=\"") FIND_FORMAT_SEPARATOR TEXT("{changesetid}") FIND_FORMAT_SEPARATOR TEXT("{date}") FIND_FORMAT_SEPARATOR TEXT("{owner}")
+		FIND_FORMAT_SEPARATOR TEXT("{branch}") FIND_FORMAT_SEPARATOR TEXT("{comment}\""));
+	Parameters.Add(TEXT("--dateformat=\"yyyy-MM-ddTHH:mm:sszzz\""));
+	Parameters.Add(TEXT("--nototal"));
+	Parameters.Add(TEXT("--encoding=\"utf-8\""));
+	TArray<FString> Results;
+	bool bCommandSuccessful = RunFindFormatCommand(Parameters, Results, OutErrorMessages);
+	if (bCommandSuccessful)
+	{
+		bCommandSuccessful = PlasticSourceControlParsers::ParseChangesetsResults(Results, OutChangesets);
+	}
+	return bCommandSuccessful;
+}
+
+// Quote a string literal in the condition of a query, doubling the single quotes it contains
+static FString QuoteQueryString(const FString& InString)
+{
+	return FString::Printf(TEXT("'%s'"), *InString.Replace(TEXT("'"), TEXT("''")));
+}
+
+// Run "find branches" commands for the names of the branches of the cached changesets, to detect the ones renamed or deleted since their changesets were fetched
+// Note: the name of a branch in a query is the last part of its full name, so the query can match other branches, that are ignored
+static bool FindExistingBranchNames(const TSet<FString>& InBranchNames, TSet<FString>& OutBranchNames, TArray<FString>& OutErrorMessages)
+{
+	TSet<FString> ShortNames;
+	for (const FString& BranchName : InBranchNames)
+	{
+		int32 SlashIndex = INDEX_NONE;
+		BranchName.FindLastChar(TEXT('/'), SlashIndex);
+		ShortNames.Add(BranchName.RightChop(SlashIndex + 1));
+	}
+
+	TArray<FString> Conditions;
+	for (const FString& ShortName : ShortNames)
+	{
+		Conditions.Add(TEXT("name = ") + QuoteQueryString(ShortName));
+	}
+
+	for (int32 FirstConditionIndex = 0; FirstConditionIndex < Conditions.Num(); FirstConditionIndex += BranchNamesQueryBatchSize)
+	{
+		FString Condition;
+		for (int32 ConditionIndex = FirstConditionIndex; ConditionIndex < FMath::Min(FirstConditionIndex + BranchNamesQueryBatchSize, Conditions.Num()); ConditionIndex++)
+		{
+			if (!Condition.IsEmpty())
+			{
+				Condition += TEXT(" or ");
+			}
+			Condition += Conditions[ConditionIndex];
+		}
+
+		TArray<FString> Parameters;
+		Parameters.Add(TEXT("branches"));
+		Parameters.Add(FString::Printf(TEXT("\"where %s\""), *Condition));
+		Parameters.Add(TEXT("--format=\"{name}\""));
+		Parameters.Add(TEXT("--nototal"));
+		Parameters.Add(TEXT("--encoding=\"utf-8\""));
+		TArray<FString> Results;
+		if (!PlasticSourceControlUtils::RunCommand(TEXT("find"), Parameters, TArray<FString>(), Results, OutErrorMessages))
+			return false;
+
+		for (FString& Result : Results)
+		{
+			Result.TrimEndInline();
+			if (InBranchNames.Contains(Result))
+			{
+				OutBranchNames.Add(MoveTemp(Result));
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * Query again a range of cached changesets by their ids, and replace them with the results:
+ * the objects of the changesets that didn't change are kept, so that the list views keep their rows,
+ * and the metadata of the ones edited or deleted is invalidated, since revisions of the history might share it, see FPlasticSourceControlChangesetMetadataTable.
+ *
+ * @param	InIndex		Index of the newest changeset of the range
+ * @param	InCount		Number of changesets in the range
+ * @param	bOutChanged	Set to true if the cache changed
+ */
+static bool RefreshChangesets(FChangesetsCache& InOutCache, const int32 InIndex, const int32 InCount, bool& bOutChanged, TArray<FString>& OutErrorMessages)
+{
+	const FString Condition = FString::Printf(TEXT("changesetid >= %d and changesetid <= %d"), InOutCache.Changesets[InIndex + InCount - 1]->ChangesetId, InOutCache.Changesets[InIndex]->ChangesetId);
+	TArray<FPlasticSourceControlChangesetRef> RefreshedChangesets;
+	if (!FindChangesets(Condition, 0, RefreshedChangesets, OutErrorMessages))
+		return false;
+
+	TMap<int32, FPlasticSourceControlChangesetRef> PreviousChangesets;
+	PreviousChangesets.Reserve(InCount);
+	for (int32 ChangesetIndex = InIndex; ChangesetIndex < InIndex + InCount; ChangesetIndex++)
+	{
+		PreviousChangesets.Add(InOutCache.Changesets[ChangesetIndex]->ChangesetId, InOutCache.Changesets[ChangesetIndex]);
+	}
+
+	int32 NumNewChangesets = 0;
+	TArray<int32> ChangedChangesetIds;
+	for (FPlasticSourceControlChangesetRef& Changeset : RefreshedChangesets)
+	{
+		if (const FPlasticSourceControlChangesetRef* PreviousChangeset = PreviousChangesets.Find(Changeset->ChangesetId))
+		{
+			if (((*PreviousChangeset)->Comment == Changeset->Comment) && ((*PreviousChangeset)->Branch == Changeset->Branch) && ((*PreviousChangeset)->CreatedBy == Changeset->CreatedBy))
+			{
+				Changeset = *PreviousChangeset;
+			}
+			else
+			{
+				ChangedChangesetIds.Add(Changeset->ChangesetId);
+			}
+			PreviousChangesets.Remove(Changeset->ChangesetId);
+		}
+		else
+		{
+			NumNewChangesets++;
+		}
+	}
+	// The previous changesets not found again were deleted
+	for (const TPair<int32, FPlasticSourceControlChangesetRef>& PreviousChangeset : PreviousChangesets)
+	{
+		ChangedChangesetIds.Add(PreviousChangeset.Key);
+	}
+
+	UE_LOG(LogSourceControl, Verbose, TEXT("UpdateChangesetsCache: %d changesets refreshed: %d new, %d edited or deleted"), InCount, NumNewChangesets, ChangedChangesetIds.Num());
+	if ((NumNewChangesets == 0) && (ChangedChangesetIds.Num() == 0))
+	{
+		return true;
+	}
+
+	if (ChangedChangesetIds.Num() > 0)
+	{
+		FPlasticSourceControlChangesetMetadataTable::Get().Invalidate(InOutCache.RepositorySpecification, ChangedChangesetIds);
+	}
+	FWriteScopeLock WriteLock(InOutCache.DataLock);
+	InOutCache.Changesets.RemoveAt(InIndex, InCount);
+	InOutCache.Changesets.Insert(MoveTemp(RefreshedChangesets), InIndex);
+	bOutChanged = true;
+	return true;
+}
+
+// Add the changesets created since the last update, with ids above the highest known one, up to a limit (0 for no limit):
+// if there are as many, others might remain in between, so they replace the cache, the older ones being loaded again by pages
+static bool AddNewChangesets(FChangesetsCache& InOutCache, const FDateTime& InFromDate, const int32 InLimit, bool& bOutChanged, TArray<FString>& OutErrorMessages)
+{
+	TArray<FPlasticSourceControlChangesetRef> NewChangesets;
+	if (!FindChangesets(FString::Printf(TEXT("changesetid > %d"), InOutCache.Changesets[0]->ChangesetId), InLimit, NewChangesets, OutErrorMessages))
+		return false;
+
+	const int32 NumNewChangesets = NewChangesets.Num();
+	if (NumNewChangesets == 0)
+	{
+		return true;
+	}
+
+	UE_LOG(LogSourceControl, Verbose, TEXT("UpdateChangesetsCache: %d new changesets"), NumNewChangesets);
+	if ((InLimit > 0) && (NumNewChangesets == InLimit))
+	{
+		ResetChangesetsCache(InOutCache, InFromDate, true, MoveTemp(NewChangesets));
+	}
+	else
+	{
+		FWriteScopeLock WriteLock(InOutCache.DataLock);
+		InOutCache.Changesets.Insert(MoveTemp(NewChangesets), 0);
+		InOutCache.RevalidationIndex += NumNewChangesets;
+	}
+	bOutChanged = true;
+	return true;
+}
+
+// Every few minutes, look for the branches of the cached changesets that no longer exist under their name, to query their changesets again
+// Note: a failure is only logged, the changesets being then displayed with the names of the branches they were fetched with until the next check
+static void CheckChangesetsBranches(FChangesetsCache& InOutCache)
+{
+	const double Now = FPlatformTime::Seconds();
+	if ((InOutCache.LastBranchesCheckTime > 0.0) && (Now - InOutCache.LastBranchesCheckTime < ChangesetsBranchesCheckInterval))
+	{
+		return;
+	}
+	InOutCache.LastBranchesCheckTime = Now;
+
+	TSet<FString> BranchNames;
+	for (const FPlasticSourceControlChangesetRef& Changeset : InOutCache.Changesets)
+	{
+		BranchNames.Add(Changeset->Branch);
+	}
+	TSet<FString> ExistingBranchNames;
+	TArray<FString> ErrorMessages;
+	if (!FindExistingBranchNames(BranchNames, ExistingBranchNames, ErrorMessages))
+	{
+		UE_LOG(LogSourceControl, Warning, TEXT("UpdateChangesetsCache: failed to check the branches of the changesets: %s"), *FString::Join(ErrorMessages, TEXT(" ")));
+		return;
+	}
+
+	InOutCache.StaleBranchNames = BranchNames.Difference(ExistingBranchNames);
+	InOutCache.StaleBranchesBeforeId = 0;
+	UE_LOG(LogSourceControl, Verbose, TEXT("UpdateChangesetsCache: %d/%d branches renamed or deleted"), InOutCache.StaleBranchNames.Num(), BranchNames.Num());
+}
+
+// Query again the next window of changesets of the branches found renamed or deleted by the last check,
+// moving past it even if their branch is still not found under its new name, so that each window is queried only once per check
+static bool RefreshStaleBranchesChangesets(FChangesetsCache& InOutCache, bool& bOutChanged, TArray<FString>& OutErrorMessages)
+{
+	int32 FirstStaleIndex = INDEX_NONE;
+	int32 LastStaleIndex = INDEX_NONE;
+	for (int32 ChangesetIndex = 0; ChangesetIndex < InOutCache.Changesets.Num(); ChangesetIndex++)
+	{
+		const FPlasticSourceControlChangesetRef& Changeset = InOutCache.Changesets[ChangesetIndex];
+		if (((InOutCache.StaleBranchesBeforeId == 0) || (Changeset->ChangesetId < InOutCache.StaleBranchesBeforeId)) && InOutCache.StaleBranchNames.Contains(Changeset->Branch))
+		{
+			if (FirstStaleIndex == INDEX_NONE)
+			{
+				FirstStaleIndex = ChangesetIndex;
+			}
+			else if (ChangesetIndex - FirstStaleIndex >= ChangesetsRevalidationWindow)
+			{
+				break;
+			}
+			LastStaleIndex = ChangesetIndex;
+		}
+	}
+	if (FirstStaleIndex == INDEX_NONE)
+	{
+		// All the changesets of these branches were queried again
+		InOutCache.StaleBranchNames.Reset();
+		return true;
+	}
+
+	UE_LOG(LogSourceControl, Verbose, TEXT("UpdateChangesetsCache: refreshing %d changesets for renamed or deleted branches"), LastStaleIndex - FirstStaleIndex + 1);
+	InOutCache.StaleBranchesBeforeId = InOutCache.Changesets[LastStaleIndex]->ChangesetId;
+	return RefreshChangesets(InOutCache, FirstStaleIndex, LastStaleIndex - FirstStaleIndex + 1, bOutChanged, OutErrorMessages);
+}
+
+/**
+ * Update the cache of changesets to cover the changesets since a date, up to a limit, querying only the ones it doesn't know yet, and bounded windows of the others:
+ * - the changesets created since the last update, with ids above the highest known one, up to the limit
+ * - every few minutes, the branches of the cached changesets, and then the changesets of the ones renamed or deleted, one window per refresh
+ * - the next window of cached changesets, in turn, to catch up with the ones edited or deleted
+ * - the changesets older than the known ones, if the date range got extended or if more are requested, by pages of ids below the lowest known one
+ */
+static bool UpdateChangesetsCache(const FString& InRepositorySpecification, const FDateTime& InFromDate, const int32 InLimit, TArray<FString>& OutErrorMessages)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::UpdateChangesetsCache);
+
+	FChangesetsCache& Cache = ChangesetsCache;
+	if (Cache.RepositorySpecification != InRepositorySpecification)
+	{
+		LoadChangesetsCache(Cache, InRepositorySpecification);
+	}
+
+	bool bCacheChanged = false;
+	if (Cache.Changesets.Num() == 0)
+	{
+		TArray<FPlasticSourceControlChangesetRef> Changesets;
+		if (!FindChangesets((InFromDate != FDateTime()) ? FormatFromDateCondition(InFromDate) : FString(), InLimit, Changesets, OutErrorMessages))
+			return false;
+
+		const bool bHasOlderChangesets = (InLimit > 0) && (Changesets.Num() == InLimit);
+		ResetChangesetsCache(Cache, InFromDate, bHasOlderChangesets, MoveTemp(Changesets));
+		bCacheChanged = true;
+		UE_LOG(LogSourceControl, Verbose, TEXT("UpdateChangesetsCache: %d changesets"), Cache.Changesets.Num());
+	}
+	else
+	{
+		if (!AddNewChangesets(Cache, InFromDate, InLimit, bCacheChanged, OutErrorMessages))
+			return false;
+
+		CheckChangesetsBranches(Cache);
+		if ((Cache.StaleBranchNames.Num() > 0) && !RefreshStaleBranchesChangesets(Cache, bCacheChanged, OutErrorMessages))
+			return false;
+
+		if (Cache.Changesets.Num() > 0)
+		{
+			if (Cache.RevalidationIndex >= Cache.Changesets.Num())
+			{
+				Cache.RevalidationIndex = 0;
+			}
+			const int32 Count = FMath::Min(ChangesetsRevalidationWindow, Cache.Changesets.Num() - Cache.RevalidationIndex);
+			if (!RefreshChangesets(Cache, Cache.RevalidationIndex, Count, bCacheChanged, OutErrorMessages))
+				return false;
+
+			Cache.RevalidationIndex += Count;
+		}
+
+		// Query only the next page of older changesets needed to reach the limit, keyed on the lowest id known rather than on an offset
+		// so that the pages stay contiguous even if changesets were created in between
+		TArray<FPlasticSourceControlChangesetRef> CachedChangesets;
+		GetChangesetsSince(Cache, InFromDate, InLimit, CachedChangesets);
+		if (HasOlderChangesets(Cache, InFromDate) && ((InLimit == 0) || (CachedChangesets.Num() < InLimit)))
+		{
+			const int32 Limit = (InLimit > 0) ? InLimit - CachedChangesets.Num() : 0;
+			TArray<FPlasticSourceControlChangesetRef> OlderChangesets;
+			if (!FindChangesets(FormatOlderChangesetsCondition(InFromDate, Cache.Changesets.Last()->ChangesetId), Limit, OlderChangesets, OutErrorMessages))
+				return false;
+
+			UE_LOG(LogSourceControl, Verbose, TEXT("UpdateChangesetsCache: %d older changesets"), OlderChangesets.Num());
+			FWriteScopeLock WriteLock(Cache.DataLock);
+			Cache.FromDate = InFromDate;
+			Cache.bHasOlderChangesets = (Limit > 0) && (OlderChangesets.Num() == Limit);
+			Cache.Changesets.Append(MoveTemp(OlderChangesets));
+			bCacheChanged = true;
+		}
+	}
+
+	if (bCacheChanged)
+	{
+		// Note: a failure to save the cache is only logged, it just means that the next session will have to query all the changesets again
+		PlasticSourceControlHistoryCache::SaveChangesets(PlasticSourceControlHistoryCache::GetChangesetsFilename(InRepositorySpecification), InRepositorySpecification, Cache.FromDate, Cache.bHasOlderChangesets, Cache.Changesets);
+	}
+
+	return true;
+}
+
+bool GetCachedChangesets(const FString& InRepositorySpecification, const FDateTime& InFromDate, const int32 InChangesetsLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+{
+	{
+		FReadScopeLock ReadLock(ChangesetsCache.DataLock);
+		if (ChangesetsCache.RepositorySpecification == InRepositorySpecification)
+		{
+			GetChangesetsSince(ChangesetsCache, InFromDate, InChangesetsLimit, OutChangesets);
+			return OutChangesets.Num() > 0;
+		}
+	}
+
+	// Load the changesets saved for this repository by a previous session, unless an update is running, that will load them itself
+	if (ChangesetsCache.CriticalSection.TryLock())
+	{
+		if (ChangesetsCache.RepositorySpecification != InRepositorySpecification)
+		{
+			LoadChangesetsCache(ChangesetsCache, InRepositorySpecification);
+		}
+		GetChangesetsSince(ChangesetsCache, InFromDate, InChangesetsLimit, OutChangesets);
+		ChangesetsCache.CriticalSection.Unlock();
+	}
+	return OutChangesets.Num() > 0;
+}
+
+// Run a "find changesets" command with the XML output, for servers not supporting the compact format, appending the results by descending id, up to a limit (0 for no limit)
+static bool FindChangesetsXml(const FString& InCondition, const int32 InLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, TArray<FString>& OutErrorMessages)
+{
+	bool bCommandSuccessful = false;
+
+	TArray<FString> Parameters;
+	Parameters.Add(TEXT("changesets"));
+	if (!InCondition.IsEmpty())
+	{
+		Parameters.Add(FString::Printf(TEXT("\"where %s\""), *InCondition));
+	}
+	Parameters.Add(TEXT("order by ChangesetId desc"));
+	if (InLimit > 0)
+	{
+		Parameters.Add(FString::Printf(TEXT("limit %d"), InLimit));
+	}
+
+	const FXmlResultOutput ChangesetResultOutput(TEXT("FindChangeset-"));
+	FString Results;
+	FString Errors;
+	Parameters.Add(ChangesetResultOutput.GetParameter());
+	Parameters.Add(TEXT("--encoding=\"utf-8\""));
+	bCommandSuccessful = PlasticSourceControlUtils::RunCommand(TEXT("find"), Parameters, TArray<FString>(), Results, Errors);
+	if (bCommandSuccessful && ChangesetResultOutput.Load(Results))
+	{
+		bCommandSuccessful = PlasticSourceControlParsers::ParseChangesetsResults(MoveTemp(Results), OutChangesets);
+	}
+	if (!Errors.IsEmpty())
+	{
+		AppendErrorMessages(Errors, OutErrorMessages);
+	}
+
+	return bCommandSuccessful;
+}
+
+bool RunGetChangesets(const FDateTime& InFromDate, const int32 InChangesetsLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, bool& bOutHasMoreChangesets, TArray<FString>& OutErrorMessages)
+{
+	bool bCommandSuccessful = false;
+
+	const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+
+	// Only a few fields are displayed, so ask for them in a compact format, an order of magnitude smaller than the XML
+	const bool bUseFormat = Provider.GetPlasticScmVersion() >= PlasticSourceControlVersions::FindFormatDate;
+	if (bUseFormat)
+	{
+		FScopeLock CacheLock(&ChangesetsCache.CriticalSection);
+		bCommandSuccessful = UpdateChangesetsCache(Provider.GetRepositorySpecification(), InFromDate, InChangesetsLimit, OutErrorMessages);
+		if (bCommandSuccessful)
+		{
+			bOutHasMoreChangesets = GetChangesetsSince(ChangesetsCache, InFromDate, InChangesetsLimit, OutChangesets);
+		}
+		return bCommandSuccessful;
+	}
+
+	bCommandSuccessful = FindChangesetsXml((InFromDate != FDateTime()) ? FormatFromDateCondition(InFromDate) : FString(), InChangesetsLimit, OutChangesets, OutErrorMessages);
+	bOutHasMoreChangesets = bCommandSuccessful && (InChangesetsLimit > 0) && (OutChangesets.Num() == InChangesetsLimit);
+
+	return bCommandSuccessful;
+}
+
+// Get the cached changesets since a date older than a given one, up to a limit
+static void GetChangesetsBefore(const FChangesetsCache& InCache, const FDateTime& InFromDate, const int32 InBeforeChangesetId, const int32 InLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets)
+{
+	const FDateTime FromDay = GetDay(InFromDate);
+	for (const FPlasticSourceControlChangesetRef& Changeset : InCache.Changesets)
+	{
+		if (OutChangesets.Num() == InLimit)
+		{
+			break;
+		}
+		if ((Changeset->ChangesetId < InBeforeChangesetId) && (Changeset->Date >= FromDay))
+		{
+			OutChangesets.Add(Changeset);
+		}
+	}
+}
+
+bool RunGetOlderChangesets(const FDateTime& InFromDate, const int32 InBeforeChangesetId, const int32 InPageSize, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, bool& bOutHasMoreChangesets, TArray<FString>& OutErrorMessages)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::RunGetOlderChangesets);
+
+	bool bCommandSuccessful = false;
+
+	const FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+
+	const bool bUseFormat = Provider.GetPlasticScmVersion() >= PlasticSourceControlVersions::FindFormatDate;
+	if (bUseFormat)
+	{
+		FScopeLock CacheLock(&ChangesetsCache.CriticalSection);
+		FChangesetsCache& Cache = ChangesetsCache;
+		// Serve the page from the cache if it covers the changesets loaded so far, querying only the older ones it doesn't know yet to complete it
+		if ((Cache.RepositorySpecification == Provider.GetRepositorySpecification()) && (Cache.Changesets.Num() > 0) && (Cache.Changesets.Last()->ChangesetId <= InBeforeChangesetId) && (InFromDate >= Cache.FromDate))
+		{
+			GetChangesetsBefore(Cache, InFromDate, InBeforeChangesetId, InPageSize, OutChangesets);
+			if ((OutChangesets.Num() < InPageSize) && HasOlderChangesets(Cache, InFromDate))
+			{
+				const int32 Limit = InPageSize - OutChangesets.Num();
+				TArray<FPlasticSourceControlChangesetRef> OlderChangesets;
+				if (!FindChangesets(FormatOlderChangesetsCondition(InFromDate, Cache.Changesets.Last()->ChangesetId), Limit, OlderChangesets, OutErrorMessages))
+					return false;
+
+				UE_LOG(LogSourceControl, Verbose, TEXT("RunGetOlderChangesets: %d older changesets"), OlderChangesets.Num());
+				OutChangesets.Append(OlderChangesets);
+				{
+					FWriteScopeLock WriteLock(Cache.DataLock);
+					Cache.FromDate = InFromDate;
+					Cache.bHasOlderChangesets = (OlderChangesets.Num() == Limit);
+					Cache.Changesets.Append(MoveTemp(OlderChangesets));
+				}
+				PlasticSourceControlHistoryCache::SaveChangesets(PlasticSourceControlHistoryCache::GetChangesetsFilename(Cache.RepositorySpecification), Cache.RepositorySpecification, Cache.FromDate, Cache.bHasOlderChangesets, Cache.Changesets);
+			}
+			bOutHasMoreChangesets = (OutChangesets.Num() == InPageSize) && ((OutChangesets.Last() != Cache.Changesets.Last()) || HasOlderChangesets(Cache, InFromDate));
+			return true;
+		}
+
+		bCommandSuccessful = FindChangesets(FormatOlderChangesetsCondition(InFromDate, InBeforeChangesetId), InPageSize, OutChangesets, OutErrorMessages);
+	}
+	else
+	{
+		bCommandSuccessful = FindChangesetsXml(FormatOlderChangesetsCondition(InFromDate, InBeforeChangesetId), InPageSize, OutChangesets, OutErrorMessages);
+	}
+	bOutHasMoreChangesets = bCommandSuccessful && (OutChangesets.Num() == InPageSize);
 
 	return bCommandSuccessful;
 }
@@ -1294,17 +2353,17 @@ bool RunGetChangesetFiles(const FPlasticSourceControlChangesetRef& InChangeset,
 {
 	bool bCommandSuccessful = false;
 
-	const FScopedTempFile LogResultFile(TEXT("Log-"), TEXT(".xml"));
+	const FXmlResultOutput LogResultOutput(TEXT("Log-"));
 	FString Results;
 	FString Errors;
 	TArray<FString> Parameters;
 	Parameters.Add(FString::Printf(TEXT("cs:%d"), InChangeset->ChangesetId));
-	Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *LogResultFile.GetFilename()));
+	Parameters.Add(LogResultOutput.GetParameter());
 	Parameters.Add(TEXT("--encoding=\"utf-8\""));
 	bCommandSuccessful = PlasticSourceControlUtils::RunCommand(TEXT("log"), Parameters, TArray<FString>(), Results, Errors);
-	if (bCommandSuccessful && FPaths::FileExists(LogResultFile.GetFilename()))
+	if (bCommandSuccessful && LogResultOutput.Load(Results))
 	{
-		bCommandSuccessful = PlasticSourceControlParsers::ParseLogResults(LogResultFile.GetFilename(), InChangeset, OutFiles);
+		bCommandSuccessful = PlasticSourceControlParsers::ParseLogResults(MoveTemp(Results), InChangeset, OutFiles);
 	}
 	if (!Errors.IsEmpty())
 	{
@@ -1318,9 +2377,9 @@ bool RunGetBranches(const FDateTime& InFromDate, TArray<FPlasticSourceControlBra
 {
 	bool bCommandSuccessful;
 
-	const FScopedTempFile BranchResultFile(TEXT("FindBranches-"), TEXT(".xml"));
-	FString Results;
-	FString Errors;
+	// Only a few fields are displayed, so ask for them in a compact format, an order of magnitude smaller than the XML
+	const bool bUseFormat = FPlasticSourceControlModule::Get().GetProvider().GetPlasticScmVersion() >= PlasticSourceControlVersions::FindFormatDate;
+
 	TArray<FString> Parameters;
 	Parameters.Add(TEXT("branches"));
 	if (InFromDate != FDateTime())
@@ -1331,12 +2390,37 @@ bool RunGetBranches(const FDateTime& InFromDate, TArray<FPlasticSourceControlBra
 			InFromDate.GetYear(), InFromDate.GetMonth(), InFromDate.GetDay()
 		));
 	}
-	Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *BranchResultFile.GetFilename()));
+	if (bUseFormat)
+	{
+		Parameters.Add(TEXT("--format=\"") FIND_FORMAT_SEPARATOR TEXT("{name}") FIND_FORMAT_SEPARATOR TEXT("{date}") FIND_FORMAT_SEPARATOR TEXT("{owner}")
+			FIND_FORMAT_SEPARATOR TEXT("{repname}") FIND_FORMAT_SEPARATOR TEXT("{repserver}") FIND_FORMAT_SEPARATOR TEXT("{comment}\""));
+		Parameters.Add(TEXT("--dateformat=\"yyyy-MM-ddTHH:mm:sszzz\""));
+		Parameters.Add(TEXT("--nototal"));
+		Parameters.Add(TEXT("--encoding=\"utf-8\""));
+		TArray<FString> Results;
+		bCommandSuccessful = RunFindFormatCommand(Parameters, Results, OutErrorMessages);
+		if (bCommandSuccessful)
+		{
+			bCommandSuccessful = PlasticSourceControlParsers::ParseBranchesResults(Results, OutBranches);
+		}
+		if (bCommandSuccessful)
+		{
+			// Save the branches for the next editor session to display them instantly, see GetCachedBranches()
+			const FString RepositorySpecification = FPlasticSourceControlModule::Get().GetProvider().GetRepositorySpecification();
+			PlasticSourceControlHistoryCache::SaveBranches(PlasticSourceControlHistoryCache::GetBranchesFilename(RepositorySpecification), RepositorySpecification, InFromDate, OutBranches);
+		}
+		return bCommandSuccessful;
+	}
+
+	const FXmlResultOutput BranchResultOutput(TEXT("FindBranches-"));
+	FString Results;
+	FString Errors;
+	Parameters.Add(BranchResultOutput.GetParameter());
 	Parameters.Add(TEXT("--encoding=\"utf-8\""));
 	bCommandSuccessful = PlasticSourceControlUtils::RunCommand(TEXT("find"), Parameters, TArray<FString>(), Results, Errors);
 	if (bCommandSuccessful)
 	{
-		bCommandSuccessful = PlasticSourceControlParsers::ParseBranchesResults(BranchResultFile.GetFilename(), OutBranches);
+		bCommandSuccessful = BranchResultOutput.Load(Results) && PlasticSourceControlParsers::ParseBranchesResults(MoveTemp(Results), OutBranches);
 	}
 	if (!Errors.IsEmpty())
 	{
@@ -1346,12 +2430,16 @@ bool RunGetBranches(const FDateTime& InFromDate, TArray<FPlasticSourceControlBra
 	return bCommandSuccessful;
 }
 
+bool GetCachedBranches(const FString& InRepositorySpecification, TArray<FPlasticSourceControlBranchRef>& OutBranches)
+{
+	FDateTime FromDate;
+	return PlasticSourceControlHistoryCache::LoadBranches(PlasticSourceControlHistoryCache::GetBranchesFilename(InRepositorySpecification), InRepositorySpecification, FromDate, OutBranches);
+}
+
 bool RunSwitch(const FString& InBranchName, const int32 InChangesetId, const bool bInIsPartialWorkspace, TArray<FString>& OutUpdatedFiles, TArray<FString>& OutErrorMessages)
 {
 	bool bResult = false;
 
-	const FScopedTempFile SwitchResultFile(TEXT("Switch-"), TEXT(".xml"));
-	TArray<FString> InfoMessages;
 	TArray<FString> Parameters;
 	if (InChangesetId != ISourceControlState::INVALID_REVISION)
 	{
@@ -1366,18 +2454,24 @@ bool RunSwitch(const FString& InBranchName, const int32 InChangesetId, const boo
 	// Detect special case for a partial checkout (CS:-1 in Gluon mode)!
 	if (!bInIsPartialWorkspace)
 	{
-		Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *SwitchResultFile.GetFilename()));
+		const FXmlResultOutput SwitchResultOutput(TEXT("Switch-"));
+		FString Results;
+		FString Errors;
+		Parameters.Add(SwitchResultOutput.GetParameter());
 		Parameters.Add(TEXT("--encoding=\"utf-8\""));
-		bResult = PlasticSourceControlUtils::RunCommand(TEXT("switch"), Parameters, TArray<FString>(), InfoMessages, OutErrorMessages);
+		bResult = PlasticSourceControlUtils::RunCommand(TEXT("switch"), Parameters, TArray<FString>(), Results, Errors);
 		if (bResult)
 		{
 			// Load and parse the result of the update command
-			FString Results;
-			if (FFileHelper::LoadFileToString(Results, *SwitchResultFile.GetFilename()))
+			if (SwitchResultOutput.Load(Results))
 			{
-				bResult = PlasticSourceControlParsers::ParseUpdateResults(Results, OutUpdatedFiles);
+				bResult = PlasticSourceControlParsers::ParseUpdateResults(MoveTemp(Results), OutUpdatedFiles);
 			}
 		}
+		if (!Errors.IsEmpty())
+		{
+			AppendErrorMessages(Errors, OutErrorMessages);
+		}
 	}
 	else
 	{
@@ -1397,23 +2491,27 @@ bool RunMergeBranch(const FString& InBranchName, TArray<FString>& OutUpdatedFile
 {
 	bool bResult = false;
 
-	const FScopedTempFile MergeResultFile(TEXT("Merge-"), TEXT(".xml"));
-	TArray<FString> InfoMessages;
+	const FXmlResultOutput MergeResultOutput(TEXT("Merge-"));
+	FString Results;
+	FString Errors;
 	TArray<FString> Parameters;
-	Parameters.Add(FString::Printf(TEXT("--xml=\"%s\""), *MergeResultFile.GetFilename()));
+	Parameters.Add(MergeResultOutput.GetParameter());
 	Parameters.Add(TEXT("--encoding=\"utf-8\""));
 	Parameters.Add(TEXT("--merge"));
 	Parameters.Add(FString::Printf(TEXT("\"br:%s\""), *InBranchName));
-	bResult = PlasticSourceControlUtils::RunCommand(TEXT("merge"), Parameters, TArray<FString>(), InfoMessages, OutErrorMessages);
+	bResult = PlasticSourceControlUtils::RunCommand(TEXT("merge"), Parameters, TArray<FString>(), Results, Errors);
 	if (bResult)
 	{
-		// Load and parse the result of the update command
-		FString Results;
-		if (FFileHelper::LoadFileToString(Results, *MergeResultFile.GetFilename()))
+		// Load and parse the result of the merge command
+		if (MergeResultOutput.Load(Results))
 		{
 			PlasticSourceControlParsers::ParseMergeResults(Results, OutUpdatedFiles);
 		}
 	}
+	if (!Errors.IsEmpty())
+	{
+		AppendErrorMessages(Errors, OutErrorMessages);
+	}
 
 	return bResult;
 }
@@ -1478,6 +2576,56 @@ bool UpdateCachedStates(TArray<FPlasticSourceControlState>&& InStates)
 	return bUpdatedStates;
 }
 
+bool UpdateCachedLocks()
+{
+	TSet<FString> Paths;
+	FPlasticSourceControlLocksIndexPtr LocksIndex;
+	{
+		FScopeLock ScopeLock(&ChangedLockPathsCriticalSection);
+		if (ChangedLockPaths.Num() == 0)
+		{
+			return false;
+		}
+		Paths = MoveTemp(ChangedLockPaths);
+		ChangedLockPaths.Reset();
+		LocksIndex = MoveTemp(ChangedLocksIndex);
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(PlasticSourceControlUtils::UpdateCachedLocks);
+
+	FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+	// Note: here is one of the rare places where we need to use a branch name, not a workspace selector
+	const FString& BranchName = Provider.GetBranchName();
+
+	// Note: remove the slash '/' from the end of the Workspace root to Combine it with server paths also starting with a slash
+	const FString& PathToWorkspaceRoot = Provider.GetPathToWorkspaceRoot();
+	const FString WorkspaceRoot = PathToWorkspaceRoot.EndsWith(TEXT("/")) ? PathToWorkspaceRoot.LeftChop(1) : PathToWorkspaceRoot;
+
+	bool bUpdatedStates = false;
+	for (const FString& Path : Paths)
+	{
+		// Only update the files already known to the Editor: the others will get the new locks from their first status
+		TSharedPtr<FPlasticSourceControlState, ESPMode::ThreadSafe> State = Provider.FindStateInternal(WorkspaceRoot + Path);
+		if (!State.IsValid())
+		{
+			continue;
+		}
+
+		// Only report that the cache was updated if the state changed in a meaningful way, useful to the Editor
+		const FString PreviousLockedBy = State->LockedBy;
+		const FString PreviousRetainedBy = State->RetainedBy;
+		PlasticSourceControlParsers::UpdateStateLocks(LocksIndex->FindByPath(Path), BranchName, *State);
+		if ((State->LockedBy != PreviousLockedBy) || (State->RetainedBy != PreviousRetainedBy))
+		{
+			bUpdatedStates = true;
+		}
+	}
+
+	UE_LOG(LogSourceControl, Verbose, TEXT("UpdateCachedLocks: %d paths with changed locks"), Paths.Num());
+
+	return bUpdatedStates;
+}
+
 void RemoveRedundantErrors(FPlasticSourceControlCommand& InCommand, const FString& InFilter)
 {
 	bool bFoundRedundantError = false;
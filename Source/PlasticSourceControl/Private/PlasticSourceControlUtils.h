@@ -16,6 +16,7 @@ struct FSoftwareVersion;
 typedef TSharedRef<class FPlasticSourceControlBranch, ESPMode::ThreadSafe> FPlasticSourceControlBranchRef;
 typedef TSharedRef<class FPlasticSourceControlChangeset, ESPMode::ThreadSafe> FPlasticSourceControlChangesetRef;
 typedef TSharedRef<class FPlasticSourceControlLock, ESPMode::ThreadSafe> FPlasticSourceControlLockRef;
+typedef TSharedPtr<const class FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe> FPlasticSourceControlLocksIndexPtr;
 typedef TSharedRef<class FPlasticSourceControlState, ESPMode::ThreadSafe> FPlasticSourceControlStateRef;
 
 enum class EWorkspaceState;
@@ -202,18 +203,56 @@ FString UserNameToDisplayName(const FString& InUserName);
 
 /**
  * Invalidate the cache of locks so that the next call to RunListLocks() will not use it and actually run the cm lock list command
+ *
+ * The previous locks are kept to be compared with the new ones, see FPlasticSourceControlLocksIndex::GetChanges()
  */
 void InvalidateLocksCache();
 
 /**
- * Run a Plastic "lock list" command and parse it.
+ * Run a Plastic "lock list" command and index the locks by path and item id, or get them from the cache.
+ *
+ * Expired locks are still returned up to LocksCacheMaxStalenessMinutes, while they are refreshed in the background, see TickLocksCache()
  *
  * @param	InProvider				The source control provider to get the repository and current branch to ask the locks for
  * @param   bInForAllDestBranches	Retrieve locks for all destination branches, or restrict them to only those applying to the working branch
- * @param	OutLocks				The list of locks
+ * @param	OutLocksIndex			The locks, indexed, with the changes since the previous list; shared with the cache, so never modified
  * @returns true if the command succeeded and returned no errors
  */
-bool RunListLocks(const FPlasticSourceControlProvider& InProvider, const bool bInForAllDestBranches, TArray<FPlasticSourceControlLockRef>& OutLocks);
+bool RunListLocks(const FPlasticSourceControlProvider& InProvider, const bool bInForAllDestBranches, FPlasticSourceControlLocksIndexPtr& OutLocksIndex);
+
+/**
+ * Refresh the caches of locks in the background, when expired locks have been served while a refresh was due,
+ * or shortly before their expiration if they are in use and the Editor is idle, so that no status has to wait for the lock list command.
+ *
+ * @param	InProvider				The source control provider to get the repository to refresh the locks of
+ * @param	bInIsIdle				No source control command is running
+ */
+void TickLocksCache(const FPlasticSourceControlProvider& InProvider, const bool bInIsIdle);
+
+/**
+ * Wait for the background refresh of the locks if any, and then empty the cache of locks, eg. when the provider is closed
+ */
+void ResetLocksCache();
+
+/**
+ * Update the cache of locks with the results of an unlock command instead of running the lock list command again.
+ *
+ * The states of the files are then updated on the game thread, see UpdateCachedLocks()
+ *
+ * @param	InUnlockedLocks		Locks that have been released or removed
+ * @param	bInRemoved			The locks were removed; released ones might be retained by the server, so they are also refreshed in the background
+ */
+void RemoveCachedLocks(const TArray<FPlasticSourceControlLockRef>& InUnlockedLocks, const bool bInRemoved);
+
+/**
+ * Split the locks to release or remove into batches, one unlock command each: by destination branch and branch, since a command takes a single --branch,
+ * then in chunks of a maximum size to stay well below the limits of the command line.
+ *
+ * @param	InLocks				Locks to release or remove
+ * @param	InMaxBatchSize		Maximum number of locks per batch
+ * @return	Batches of locks, each one keeping the order of the locks to unlock
+ */
+TArray<TArray<FPlasticSourceControlLockRef>> BatchLocksToUnlock(const TArray<FPlasticSourceControlLockRef>& InLocks, const int32 InMaxBatchSize);
 
 /**
  * Get locks applying to the working branch for the specified files.
@@ -267,8 +306,9 @@ bool RunGetFile(const FString& InRevSpec, const FString& InDumpFileName);
  * @param	bInUpdateHistory	If getting the history of files, versus only checking the heads of branches to detect newer commits
  * @param	InOutStates			The file states to update with the history
  * @param	OutErrorMessages	Any errors (from StdErr) as an array per-line
+ * @param	InHistoryLimit		Number of revisions to get when updating the history, 0 for only a first page (HistoryPageSize) of a selection of several files, INDEX_NONE for the full history (up to LimitNumberOfRevisionsInHistory)
  */
-bool RunGetHistory(const bool bInUpdateHistory, TArray<FPlasticSourceControlState>& InOutStates, TArray<FString>& OutErrorMessages);
+bool RunGetHistory(const bool bInUpdateHistory, TArray<FPlasticSourceControlState>& InOutStates, TArray<FString>& OutErrorMessages, const int32 InHistoryLimit = 0);
 
 /**
  * Run a Plastic "update" command to sync the workspace and parse its XML results.
@@ -321,14 +361,46 @@ void AddShelvedFileToChangelist(FPlasticSourceControlChangelistState& InOutChang
 #endif
 
 /**
- * Run find "changesets where date >= 'YYYY-MM-DD'" and parse the results.
+ * Run find "changesets where date >= 'YYYY-MM-DD' order by ChangesetId desc limit N" and parse the results.
+ *
+ * The changesets are cached per repository: the next calls only query in full the ones created since, with ids above the highest known one,
+ * and the next page of older ones if the date range got extended or the limit raised. A bounded window of the known ones is also queried again in turn,
+ * and their branches are checked every few minutes, to catch up with the comments edited, the changesets deleted and the branches renamed or deleted in the meantime.
+ * The cache is also saved to disk, so that the first call of the next editor sessions starts from there.
+ *
  * @param	InFromDate				The date to search from
+ * @param	InChangesetsLimit		Number of changesets to get, the newest ones, 0 to get all of them
  * @param	OutChangesets			The list of changesets, without their files
+ * @param	bOutHasMoreChangesets	Whether older changesets remain to be loaded by raising the limit
  * @param	OutErrorMessages		Any errors (from StdErr) as an array per-line
  *
  * @see RunGetChangesetFiles() below used to populated a specific changeset with its list of files
  */
-bool RunGetChangesets(const FDateTime& InFromDate, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, TArray<FString>& OutErrorMessages);
+bool RunGetChangesets(const FDateTime& InFromDate, const int32 InChangesetsLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, bool& bOutHasMoreChangesets, TArray<FString>& OutErrorMessages);
+
+/**
+ * Run find "changesets where date >= 'YYYY-MM-DD' and changesetid < N order by ChangesetId desc limit P" to get the next page of older changesets,
+ * without querying again the ones already loaded. The page is served from the cache of RunGetChangesets() when it covers the changesets loaded so far,
+ * only the older changesets it doesn't know yet being queried, and then added to it.
+ *
+ * @param	InFromDate				The date to search from
+ * @param	InBeforeChangesetId		Id of the oldest changeset already loaded
+ * @param	InPageSize				Number of older changesets to get
+ * @param	OutChangesets			The page of changesets, by descending ids
+ * @param	bOutHasMoreChangesets	Whether older changesets remain to be loaded by the next page
+ * @param	OutErrorMessages		Any errors (from StdErr) as an array per-line
+ */
+bool RunGetOlderChangesets(const FDateTime& InFromDate, const int32 InBeforeChangesetId, const int32 InPageSize, TArray<FPlasticSourceControlChangesetRef>& OutChangesets, bool& bOutHasMoreChangesets, TArray<FString>& OutErrorMessages);
+
+/**
+ * Get the changesets cached by RunGetChangesets(), loading them from the previous editor session if needed, to display them instantly before their update.
+ * @param	InRepositorySpecification	The repository of the workspace
+ * @param	InFromDate				The date to search from
+ * @param	InChangesetsLimit		Number of changesets to get, the newest ones, 0 to get all of them
+ * @param	OutChangesets			The list of changesets cached, possibly not covering the whole date range yet
+ * @returns false if no changesets are cached for this repository
+ */
+bool GetCachedChangesets(const FString& InRepositorySpecification, const FDateTime& InFromDate, const int32 InChangesetsLimit, TArray<FPlasticSourceControlChangesetRef>& OutChangesets);
 
 /**
  * Run "log cs:<ChangesetId> --xml" and parse the results to populate the files from the specified changeset.
@@ -346,6 +418,14 @@ bool RunGetChangesetFiles(const FPlasticSourceControlChangesetRef& InChangeset,
  */
 bool RunGetBranches(const FDateTime& InFromDate, TArray<FPlasticSourceControlBranchRef>& OutBranches, TArray<FString>& OutErrorMessages);
 
+/**
+ * Get the branches saved to disk by the last RunGetBranches(), possibly in a previous editor session, to display them instantly before their update.
+ * @param	InRepositorySpecification	The repository of the workspace
+ * @param	OutBranches				The list of branches of the last call, whatever its date filter
+ * @returns false if no branches are cached for this repository
+ */
+bool GetCachedBranches(const FString& InRepositorySpecification, TArray<FPlasticSourceControlBranchRef>& OutBranches);
+
 /**
  * Run switch br:/name and parse the results.
  * @param	InBranchName			The name of the branch to switch the workspace to (optional, only used if no InChangesetId)
@@ -393,6 +473,13 @@ bool RunDeleteBranches(const TArray<FString>& InBranchNames, TArray<FString>& Ou
  */
 bool UpdateCachedStates(TArray<FPlasticSourceControlState>&& InStates);
 
+/**
+ * Update the lock information of the cached states of the files whose locks changed on the working branch since the last call.
+ * Called on the game thread, so that the files locked or unlocked outside of a status operation get updated.
+ * @returns true if any states were updated
+ */
+bool UpdateCachedLocks();
+
 /**
  * Remove redundant errors (that contain a particular string) and also
  * update the commands success status if all errors were removed.
@@ -1,10 +1,19 @@
 // Copyright (c) 2024 Unity Technologies
 
 #include "PlasticSourceControlUtils.h"
+#include "PlasticSourceControlBranch.h"
+#include "PlasticSourceControlChangeset.h"
+#include "PlasticSourceControlHistoryCache.h"
+#include "PlasticSourceControlParsers.h"
+#include "PlasticSourceControlSyntheticOutputs.h"
 #include "SoftwareVersion.h"
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#include "HAL/FileManager.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFindCommonDirectoryUnitTest, "PlasticSCM.FindCommonDirectory", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
 
@@ -155,4 +164,117 @@ bool FSoftwareVersionMoreOrEqualUnitTest::RunTest(const FString& Parameters)
 	return true; // actual results are returned by TestXxx() macros
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHistoryCacheUnitTest, "PlasticSCM.HistoryCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FHistoryCacheUnitTest::RunTest(const FString& Parameters)
+{
+	const FString RepositorySpecification(TEXT("UE5PlasticPluginDev@test@cloud"));
+	const FString OtherRepositorySpecification(TEXT("UE5PlasticPluginDev@other@cloud"));
+	const FDateTime FromDate(2024, 1, 15);
+
+	TestNotEqual(TEXT("Cache per repository"), PlasticSourceControlHistoryCache::GetChangesetsFilename(RepositorySpecification), PlasticSourceControlHistoryCache::GetChangesetsFilename(OtherRepositorySpecification));
+	TestNotEqual(TEXT("Cache per kind"), PlasticSourceControlHistoryCache::GetChangesetsFilename(RepositorySpecification), PlasticSourceControlHistoryCache::GetBranchesFilename(RepositorySpecification));
+
+	const FString ChangesetsFilename = FPaths::AutomationTransientDir() / TEXT("PlasticSourceControl") / TEXT("Changesets.bin");
+	TArray<FPlasticSourceControlChangesetRef> Changesets;
+	PlasticSourceControlParsers::ParseChangesetsResults(PlasticSourceControlSyntheticOutputs::GenerateChangesetsFormat(1000), Changesets);
+	TestTrue(TEXT("SaveChangesets"), PlasticSourceControlHistoryCache::SaveChangesets(ChangesetsFilename, RepositorySpecification, FromDate, true, Changesets));
+
+	FDateTime LoadedFromDate;
+	bool bLoadedHasOlderChangesets = false;
+	TArray<FPlasticSourceControlChangesetRef> LoadedChangesets;
+	TestTrue(TEXT("LoadChangesets"), PlasticSourceControlHistoryCache::LoadChangesets(ChangesetsFilename, RepositorySpecification, LoadedFromDate, bLoadedHasOlderChangesets, LoadedChangesets));
+	TestTrue(TEXT("Changesets from date"), LoadedFromDate == FromDate);
+	TestTrue(TEXT("Has older changesets"), bLoadedHasOlderChangesets);
+	TestEqual(TEXT("Number of changesets"), LoadedChangesets.Num(), Changesets.Num());
+	if (LoadedChangesets.Num() == Changesets.Num())
+	{
+		for (int32 Index = 0; Index < Changesets.Num(); Index++)
+		{
+			const FPlasticSourceControlChangeset& Changeset = *Changesets[Index];
+			const FPlasticSourceControlChangeset& LoadedChangeset = *LoadedChangesets[Index];
+			if (!TestEqual(TEXT("ChangesetId"), LoadedChangeset.ChangesetId, Changeset.ChangesetId)
+				|| !TestEqual(TEXT("CreatedBy"), LoadedChangeset.CreatedBy, Changeset.CreatedBy)
+				|| !TestTrue(TEXT("Date"), LoadedChangeset.Date == Changeset.Date)
+				|| !TestEqual(TEXT("Branch"), LoadedChangeset.Branch, Changeset.Branch)
+				|| !TestEqual(TEXT("Comment"), LoadedChangeset.Comment, Changeset.Comment))
+			{
+				break;
+			}
+		}
+	}
+
+	TArray<FPlasticSourceControlChangesetRef> OtherChangesets;
+	TestFalse(TEXT("LoadChangesets of another repository"), PlasticSourceControlHistoryCache::LoadChangesets(ChangesetsFilename, OtherRepositorySpecification, LoadedFromDate, bLoadedHasOlderChangesets, OtherChangesets));
+	TestEqual(TEXT("No changesets of another repository"), OtherChangesets.Num(), 0);
+
+	const FString BranchesFilename = FPaths::AutomationTransientDir() / TEXT("PlasticSourceControl") / TEXT("Branches.bin");
+	TArray<FPlasticSourceControlBranchRef> Branches;
+	PlasticSourceControlParsers::ParseBranchesResults(PlasticSourceControlSyntheticOutputs::GenerateBranchesFormat(100), Branches);
+	TestTrue(TEXT("SaveBranches"), PlasticSourceControlHistoryCache::SaveBranches(BranchesFilename, RepositorySpecification, FDateTime(), Branches));
+
+	TArray<FPlasticSourceControlBranchRef> LoadedBranches;
+	TestTrue(TEXT("LoadBranches"), PlasticSourceControlHistoryCache::LoadBranches(BranchesFilename, RepositorySpecification, LoadedFromDate, LoadedBranches));
+	TestTrue(TEXT("Branches from date"), LoadedFromDate == FDateTime());
+	TestEqual(TEXT("Number of branches"), LoadedBranches.Num(), Branches.Num());
+	if (LoadedBranches.Num() == Branches.Num())
+	{
+		for (int32 Index = 0; Index < Branches.Num(); Index++)
+		{
+			const FPlasticSourceControlBranch& Branch = *Branches[Index];
+			const FPlasticSourceControlBranch& LoadedBranch = *LoadedBranches[Index];
+			if (!TestEqual(TEXT("Name"), LoadedBranch.Name, Branch.Name)
+				|| !TestEqual(TEXT("Repository"), LoadedBranch.Repository, Branch.Repository)
+				|| !TestEqual(TEXT("CreatedBy"), LoadedBranch.CreatedBy, Branch.CreatedBy)
+				|| !TestTrue(TEXT("Date"), LoadedBranch.Date == Branch.Date)
+				|| !TestEqual(TEXT("Comment"), LoadedBranch.Comment, Branch.Comment))
+			{
+				break;
+			}
+		}
+	}
+
+	// The kind of content is checked, as well as its integrity
+	TArray<FPlasticSourceControlBranchRef> WrongBranches;
+	TestFalse(TEXT("LoadBranches of changesets"), PlasticSourceControlHistoryCache::LoadBranches(ChangesetsFilename, RepositorySpecification, LoadedFromDate, WrongBranches));
+	TArray<uint8> TruncatedData;
+	FFileHelper::LoadFileToArray(TruncatedData, *BranchesFilename);
+	TruncatedData.SetNum(TruncatedData.Num() / 2);
+	FFileHelper::SaveArrayToFile(TruncatedData, *BranchesFilename);
+	TestFalse(TEXT("LoadBranches truncated"), PlasticSourceControlHistoryCache::LoadBranches(BranchesFilename, RepositorySpecification, LoadedFromDate, WrongBranches));
+	TestEqual(TEXT("No truncated branches"), WrongBranches.Num(), 0);
+
+	// A corrupted length of string, here the one of the first owner of the table, fails the load instead of allocating the string
+	TArray<uint8> CorruptedData;
+	FFileHelper::LoadFileToArray(CorruptedData, *ChangesetsFilename);
+	TArray<uint8> OwnerData;
+	FMemoryWriter OwnerWriter(OwnerData);
+	FString Owner = Changesets[0]->CreatedBy;
+	OwnerWriter << Owner;
+	int32 OwnerOffset = INDEX_NONE;
+	for (int32 Offset = 0; Offset + OwnerData.Num() <= CorruptedData.Num(); Offset++)
+	{
+		if (FMemory::Memcmp(CorruptedData.GetData() + Offset, OwnerData.GetData(), OwnerData.Num()) == 0)
+		{
+			OwnerOffset = Offset;
+			break;
+		}
+	}
+	if (TestNotEqual(TEXT("Owner found in the cache"), OwnerOffset, static_cast<int32>(INDEX_NONE)))
+	{
+		const int32 CorruptedLength = 0x40000000;
+		FMemory::Memcpy(CorruptedData.GetData() + OwnerOffset, &CorruptedLength, sizeof(CorruptedLength));
+		FFileHelper::SaveArrayToFile(CorruptedData, *ChangesetsFilename);
+		AddExpectedError(TEXT("String is too large"), EAutomationExpectedErrorFlags::Contains, 1);
+		TArray<FPlasticSourceControlChangesetRef> WrongChangesets;
+		TestFalse(TEXT("LoadChangesets with a corrupted length"), PlasticSourceControlHistoryCache::LoadChangesets(ChangesetsFilename, RepositorySpecification, LoadedFromDate, bLoadedHasOlderChangesets, WrongChangesets));
+		TestEqual(TEXT("No corrupted changesets"), WrongChangesets.Num(), 0);
+	}
+
+	IFileManager::Get().Delete(*ChangesetsFilename);
+	IFileManager::Get().Delete(*BranchesFilename);
+
+	return true; // actual results are returned by TestXxx() macros
+}
+
 #endif
@@ -52,6 +52,10 @@ namespace PlasticSourceControlVersions
 	// https://plasticscm.com/download/releasenotes/11.0.16.8133 (2023/08/03)
 	static const FSoftwareVersion SmartLocks(TEXT("11.0.16.8133"));
 
+	// 11.0.16.8133 the same non-localized --dateformat makes the dates of 'cm find --format' parsable,
+	// to list changesets and branches with a compact format instead of the much larger XML
+	static const FSoftwareVersion FindFormatDate(TEXT("11.0.16.8133"));
+
 	// 11.0.16.8445 lock list new --workingbranch option to only list the locks that apply to the destination branch of the specified branch.
 	// https://plasticscm.com/download/releasenotes/11.0.16.8445 (2024/02/22)
 	static const FSoftwareVersion WorkingBranch(TEXT("11.0.16.8445"));
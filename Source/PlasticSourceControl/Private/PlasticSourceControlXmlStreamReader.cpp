@@ -0,0 +1,85 @@
+// Copyright (c) 2024 Unity Technologies
+
+#include "PlasticSourceControlXmlStreamReader.h"
+
+FPlasticSourceControlXmlStreamReader::FPlasticSourceControlXmlStreamReader(const TCHAR* InRootElement)
+	: RootElement(InRootElement)
+{
+}
+
+bool FPlasticSourceControlXmlStreamReader::ParseBuffer(FString& InOutXmlBuffer)
+{
+	if (InOutXmlBuffer.IsEmpty())
+	{
+		LastError = TEXT("empty buffer");
+		return false;
+	}
+
+	FText ErrorMessage;
+	int32 ErrorLineNumber = 0;
+	const bool bParsed = FFastXml::ParseXmlFile(this, TEXT(""), InOutXmlBuffer.GetCharArray().GetData(), nullptr, false, false, ErrorMessage, ErrorLineNumber);
+	if (!bParsed && LastError.IsEmpty())
+	{
+		LastError = FString::Printf(TEXT("%s (line %d)"), *ErrorMessage.ToString(), ErrorLineNumber);
+	}
+	else if (bParsed && !bRootElementFound)
+	{
+		LastError = FString::Printf(TEXT("missing root element <%s>"), RootElement);
+	}
+	else if (bParsed && (Depth > 0))
+	{
+		LastError = FString::Printf(TEXT("truncated XML: unclosed element <%s>"), *ElementNames[Depth - 1]);
+	}
+
+	return bParsed && bRootElementFound && (Depth == 0);
+}
+
+bool FPlasticSourceControlXmlStreamReader::ProcessXmlDeclaration(const TCHAR* ElementData, int32 XmlFileLineNumber)
+{
+	return true;
+}
+
+bool FPlasticSourceControlXmlStreamReader::ProcessElement(const TCHAR* ElementName, const TCHAR* ElementData, int32 XmlFileLineNumber)
+{
+	if (Depth == 0)
+	{
+		if (bRootElementFound || FCString::Strcmp(ElementName, RootElement) != 0)
+		{
+			LastError = FString::Printf(TEXT("unexpected root element <%s> at line %d"), ElementName, XmlFileLineNumber);
+			return false;
+		}
+		bRootElementFound = true;
+	}
+
+	if (Depth == ElementNames.Num())
+	{
+		ElementNames.AddDefaulted();
+		ElementContents.AddDefaulted();
+	}
+	ElementNames[Depth] = ElementName;
+	ElementContents[Depth] = ElementData ? ElementData : TEXT("");
+
+	return OnElementStart(ElementNames[Depth], Depth++);
+}
+
+bool FPlasticSourceControlXmlStreamReader::ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue)
+{
+	return true;
+}
+
+bool FPlasticSourceControlXmlStreamReader::ProcessClose(const TCHAR* Element)
+{
+	if (Depth == 0)
+	{
+		LastError = FString::Printf(TEXT("unexpected closing element </%s>"), Element);
+		return false;
+	}
+
+	Depth--;
+	return OnElementEnd(ElementNames[Depth], MoveTemp(ElementContents[Depth]), Depth);
+}
+
+bool FPlasticSourceControlXmlStreamReader::ProcessComment(const TCHAR* Comment)
+{
+	return true;
+}
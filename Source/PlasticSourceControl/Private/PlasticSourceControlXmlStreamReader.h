@@ -0,0 +1,70 @@
+// Copyright (c) 2024 Unity Technologies
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FastXml.h"
+
+/**
+ * Forward-only streaming reader for the XML results of cm commands, built on the FFastXml tokenizer of the XmlParser module.
+ *
+ * Contrary to FXmlFile, it does not build a DOM of the whole document in memory:
+ * sub-classes implement a state machine on top of the element events, only keeping what they need.
+ *
+ * Note: it is not streaming from disk, FFastXml tokenizing a buffer holding the whole document,
+ * so the peak memory is still at least the size of the document; what it saves is the DOM built on top of it.
+ */
+class FPlasticSourceControlXmlStreamReader : public IFastXmlCallback
+{
+public:
+	/** Constructor - the tag of the root element that the document is expected to start with */
+	explicit FPlasticSourceControlXmlStreamReader(const TCHAR* InRootElement);
+	virtual ~FPlasticSourceControlXmlStreamReader() = default;
+
+	/** Parse the XML content of a buffer, modified in place by the tokenizer, returning false if it could not be parsed, or if the root element is not the expected one */
+	bool ParseBuffer(FString& InOutXmlBuffer);
+
+	/** Description of the last parsing error */
+	const FString& GetLastError() const
+	{
+		return LastError;
+	}
+
+protected:
+	/** Called on opening an element, at a depth of 0 for the root element. Return false to abort parsing. */
+	virtual bool OnElementStart(const FString& InName, const int32 InDepth)
+	{
+		return true;
+	}
+
+	/** Called on closing an element, with its text content, at a depth of 0 for the root element. Return false to abort parsing. */
+	virtual bool OnElementEnd(const FString& InName, FString&& InContent, const int32 InDepth)
+	{
+		return true;
+	}
+
+private:
+	// IFastXmlCallback interface
+	virtual bool ProcessXmlDeclaration(const TCHAR* ElementData, int32 XmlFileLineNumber) override;
+	virtual bool ProcessElement(const TCHAR* ElementName, const TCHAR* ElementData, int32 XmlFileLineNumber) override;
+	virtual bool ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue) override;
+	virtual bool ProcessClose(const TCHAR* Element) override;
+	virtual bool ProcessComment(const TCHAR* Comment) override;
+
+	/** Expected tag of the root element */
+	const TCHAR* RootElement;
+
+	/** Was the expected root element found */
+	bool bRootElementFound = false;
+
+	/** Stack of the names of the currently opened elements, never shrunk to reuse their allocations */
+	TArray<FString> ElementNames;
+	/** Stack of the contents of the currently opened elements, each moved out to OnElementEnd() when closing its element */
+	TArray<FString> ElementContents;
+
+	/** Number of currently opened elements */
+	int32 Depth = 0;
+
+	/** Description of the last parsing error */
+	FString LastError;
+};
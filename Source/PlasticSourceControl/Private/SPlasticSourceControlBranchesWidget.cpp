@@ -17,6 +17,8 @@
 
 #include "ISourceControlModule.h"
 
+#include "Async/Async.h"
+
 #include "Logging/MessageLog.h"
 #include "ToolMenus.h"
 #include "ToolMenuContext.h"
@@ -1029,6 +1031,14 @@ void SPlasticSourceControlBranchesWidget::Tick(const FGeometry& AllottedGeometry
 		bShouldRefresh = true;
 	}
 
+	// Display the branches of the previous session as soon as they are loaded, and only then query them
+	if (PendingCachedBranches.IsValid() && PendingCachedBranches.IsReady())
+	{
+		SourceControlBranches = PendingCachedBranches.Consume();
+		OnRefreshUI();
+		RequestBranchesRefresh();
+	}
+
 	if (bShouldRefresh)
 	{
 		RequestBranchesRefresh();
@@ -1090,13 +1100,27 @@ void SPlasticSourceControlBranchesWidget::RequestBranchesRefresh()
 
 	StartRefreshStatus();
 
+	FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+
+	// On the first refresh, start by loading in the background the branches cached by the previous session, see Tick()
+	if (!bCachedBranchesRequested)
+	{
+		bCachedBranchesRequested = true;
+		PendingCachedBranches = Async(EAsyncExecution::ThreadPool, [RepositorySpecification = Provider.GetRepositorySpecification()]()
+		{
+			TArray<FPlasticSourceControlBranchRef> CachedBranches;
+			PlasticSourceControlUtils::GetCachedBranches(RepositorySpecification, CachedBranches);
+			return CachedBranches;
+		});
+		return;
+	}
+
 	TSharedRef<FPlasticGetBranches, ESPMode::ThreadSafe> GetBranchesOperation = ISourceControlOperation::Create<FPlasticGetBranches>();
 	if (FromDateInDays > -1)
 	{
 		GetBranchesOperation->FromDate = FDateTime::Now() - FTimespan::FromDays(FromDateInDays);
 	}
 
-	FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
 	Provider.Execute(GetBranchesOperation, EConcurrency::Asynchronous, FSourceControlOperationComplete::CreateSP(this, &SPlasticSourceControlBranchesWidget::OnGetBranchesOperationComplete));
 }
 
@@ -1106,6 +1130,7 @@ void SPlasticSourceControlBranchesWidget::OnGetBranchesOperationComplete(const F
 
 	TSharedRef<FPlasticGetBranches, ESPMode::ThreadSafe> OperationGetBranches = StaticCastSharedRef<FPlasticGetBranches>(InOperation);
 	SourceControlBranches = MoveTemp(OperationGetBranches->Branches);
+	PendingCachedBranches.Reset(); // Outdated by the results of the operation
 
 	WorkspaceSelector = FPlasticSourceControlModule::Get().GetProvider().GetWorkspaceSelector();
 
@@ -6,6 +6,7 @@
 
 #include "Notification.h"
 
+#include "Async/Future.h"
 #include "Misc/TextFilter.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Widgets/SCompoundWidget.h"
@@ -132,6 +133,10 @@ private:
 	TArray<FPlasticSourceControlBranchRef> SourceControlBranches; // Full list from source (filtered by date)
 	TArray<FPlasticSourceControlBranchRef> BranchRows; // Filtered list to display based on the search text filter
 
+	/** Branches cached by the previous session, loaded on a background thread to be displayed before the first refresh, see RequestBranchesRefresh() */
+	TFuture<TArray<FPlasticSourceControlBranchRef>> PendingCachedBranches;
+	bool bCachedBranchesRequested = false;
+
 	/** Delegate handle for the HandleSourceControlStateChanged function callback */
 	FDelegateHandle SourceControlStateChangedDelegateHandle;
 
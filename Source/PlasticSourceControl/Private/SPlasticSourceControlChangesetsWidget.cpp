@@ -12,7 +12,9 @@
 
 #include "PackageUtils.h"
 
+#include "Algo/Reverse.h"
 #include "AssetRegistry/AssetData.h"
+#include "Async/Async.h"
 #include "AssetToolsModule.h"
 #include "DesktopPlatformModule.h"
 #include "DiffUtils.h"
@@ -54,6 +56,9 @@
 
 #define LOCTEXT_NAMESPACE "PlasticSourceControlChangesetWindow"
 
+// Maximum number of pages loaded in a row while the search text filters out all the changesets, so as not to load the whole date range for a search matching nothing
+static const int32 MaxPagesWithoutMatch = 5;
+
 void SPlasticSourceControlChangesetsWidget::Construct(const FArguments& InArgs)
 {
 	ISourceControlModule::Get().RegisterProviderChanged(FSourceControlProviderChanged::FDelegate::CreateSP(this, &SPlasticSourceControlChangesetsWidget::OnSourceControlProviderChanged));
@@ -520,6 +525,7 @@ void SPlasticSourceControlChangesetsWidget::OnChangesetsSearchTextChanged(const
 {
 	ChangesetsSearchTextFilter->SetRawFilterText(InFilterText);
 	ChangesetsSearchBox->SetError(ChangesetsSearchTextFilter->GetFilterErrorText());
+	NumPagesWithoutMatch = 0; // Look for the new search text in the next pages
 }
 
 void SPlasticSourceControlChangesetsWidget::OnFilesSearchTextChanged(const FText& InFilterText)
@@ -541,6 +547,8 @@ void SPlasticSourceControlChangesetsWidget::PopulateItemSearchStrings(const FPla
 void SPlasticSourceControlChangesetsWidget::OnFromDateChanged(int32 InFromDateInDays)
 {
 	FromDateInDays = InFromDateInDays;
+	ChangesetsLimit = 0; // Start again from the first page
+	NumPagesWithoutMatch = 0;
 	bShouldRefresh = true;
 }
 
@@ -606,13 +614,13 @@ void SPlasticSourceControlChangesetsWidget::OnFilesRefreshUI()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlChangesetsWidget::OnFilesRefreshUI);
 
-	if (SourceSelectedChangeset.IsValid())
+	if (const TArray<FPlasticSourceControlStateRef>* Files = SourceSelectedChangeset.IsValid() ? ChangesetsFiles.Find(SourceSelectedChangeset->ChangesetId) : nullptr)
 	{
-		const int32 ItemCount = SourceSelectedChangeset->Files.Num();
+		const int32 ItemCount = Files->Num();
 		FileRows.Empty(ItemCount);
 		for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
 		{
-			const FPlasticSourceControlStateRef& Item = SourceSelectedChangeset->Files[ItemIndex];
+			const FPlasticSourceControlStateRef& Item = (*Files)[ItemIndex];
 			if (FilesSearchTextFilter->PassesFilter(Item.Get()))
 			{
 				FileRows.Emplace(Item);
@@ -678,11 +686,8 @@ void SPlasticSourceControlChangesetsWidget::OnChangesetsColumnSortModeChanged(co
 		ChangesetsSecondarySortMode = InSortMode;
 	}
 
-	if (ChangesetsListView)
-	{
-		SortChangesetsView();
-		ChangesetsListView->RequestListRefresh();
-	}
+	// Filter the rows again from the source list, to sort them starting from the order of the query, see SortChangesetsView()
+	OnChangesetsRefreshUI();
 }
 
 void SPlasticSourceControlChangesetsWidget::SortChangesetsView()
@@ -694,6 +699,17 @@ void SPlasticSourceControlChangesetsWidget::SortChangesetsView()
 		return; // No column selected for sorting or nothing to sort.
 	}
 
+	// The changesets are queried by descending ids, and the rows are filtered in this order: no need to sort them by id, at most to reverse them.
+	// Note: this is the only order of the query, since the pages of changesets are loaded by ids; sorting by any other column only sorts the pages loaded so far
+	if (ChangesetsPrimarySortedColumn == PlasticSourceControlChangesetsListViewColumn::ChangesetId::Id())
+	{
+		if (ChangesetsPrimarySortMode == EColumnSortMode::Ascending)
+		{
+			Algo::Reverse(ChangesetRows);
+		}
+		return;
+	}
+
 	auto CompareChangesetIds = [](const FPlasticSourceControlChangeset* Lhs, const FPlasticSourceControlChangeset* Rhs)
 	{
 		return Lhs->ChangesetId < Rhs->ChangesetId ? -1 : (Lhs->ChangesetId == Rhs->ChangesetId ? 0 : 1);
@@ -1517,7 +1533,7 @@ static UObject* GetAssetRevisionObject(FPlasticSourceControlRevisionRef& InRevis
 	// fill out the revision info
 	OutSelectedRevisionInfo.Revision = InRevision->Revision;
 	OutSelectedRevisionInfo.Changelist = InRevision->ChangesetNumber;
-	OutSelectedRevisionInfo.Date = InRevision->Date;
+	OutSelectedRevisionInfo.Date = InRevision->GetDate();
 
 	return AssetObject;
 }
@@ -1539,7 +1555,7 @@ static UObject* GetAssetRevisionObject(const FPlasticSourceControlStateRef& InSe
 	// fill out the revision info
 	OutSelectedRevisionInfo.Revision = SelectedRevision->Revision;
 	OutSelectedRevisionInfo.Changelist = SelectedRevision->ChangesetNumber;
-	OutSelectedRevisionInfo.Date = SelectedRevision->Date;
+	OutSelectedRevisionInfo.Date = SelectedRevision->GetDate();
 
 	return AssetObject;
 }
@@ -1827,6 +1843,14 @@ void SPlasticSourceControlChangesetsWidget::Tick(const FGeometry& AllottedGeomet
 		bShouldRefresh = true;
 	}
 
+	// Display the changesets of the previous session as soon as they are loaded, and only then query the ones created since
+	if (PendingCachedChangesets.IsValid() && PendingCachedChangesets.IsReady())
+	{
+		SourceControlChangesets = PendingCachedChangesets.Consume();
+		OnChangesetsRefreshUI();
+		RequestChangesetsRefresh();
+	}
+
 	// Auto refresh at regular intervals
 	const double CurrentTime = FPlatformTime::Seconds();
 	if (CurrentTime - LastRefreshTime > (10 * 60))
@@ -1841,6 +1865,25 @@ void SPlasticSourceControlChangesetsWidget::Tick(const FGeometry& AllottedGeomet
 		bShouldRefresh = false;
 	}
 
+	// Load the next page of changesets as soon as the end of the list gets into view,
+	// or if the search text filters out all the changesets loaded so far, but only for a few pages
+	if (bHasMoreChangesets && !bIsRefreshing && ChangesetsListView.IsValid())
+	{
+		if (ChangesetRows.Num() > 0)
+		{
+			NumPagesWithoutMatch = 0;
+			if (ChangesetsListView->IsItemVisible(ChangesetRows.Last()))
+			{
+				RequestNextChangesetsPage();
+			}
+		}
+		else if (NumPagesWithoutMatch < MaxPagesWithoutMatch)
+		{
+			NumPagesWithoutMatch++;
+			RequestNextChangesetsPage();
+		}
+	}
+
 	if (bIsRefreshing)
 	{
 		TickRefreshStatus(InDeltaTime);
@@ -1868,6 +1911,11 @@ void SPlasticSourceControlChangesetsWidget::EndRefreshStatus()
 	RefreshStatus = FText::GetEmpty();
 }
 
+FDateTime SPlasticSourceControlChangesetsWidget::GetFromDate() const
+{
+	return (FromDateInDays > -1) ? FDateTime::Now() - FTimespan::FromDays(FromDateInDays) : FDateTime();
+}
+
 void SPlasticSourceControlChangesetsWidget::RequestChangesetsRefresh()
 {
 	if (!ISourceControlModule::Get().IsEnabled() || (!FPlasticSourceControlModule::Get().GetProvider().IsAvailable()))
@@ -1877,13 +1925,59 @@ void SPlasticSourceControlChangesetsWidget::RequestChangesetsRefresh()
 
 	StartRefreshStatus();
 
+	const FDateTime FromDate = GetFromDate();
+	FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+
+	// Load only the first page of changesets, or as many as already loaded, the next ones being loaded on demand
+	if (ChangesetsLimit == 0)
+	{
+		ChangesetsLimit = GetDefault<UPlasticSourceControlProjectSettings>()->ChangesetsPageSize;
+	}
+
+	// On the first refresh, start by loading in the background the changesets cached by the previous session, see Tick()
+	if (!bCachedChangesetsRequested)
+	{
+		bCachedChangesetsRequested = true;
+		PendingCachedChangesets = Async(EAsyncExecution::ThreadPool, [RepositorySpecification = Provider.GetRepositorySpecification(), FromDate, Limit = ChangesetsLimit]()
+		{
+			TArray<FPlasticSourceControlChangesetRef> CachedChangesets;
+			PlasticSourceControlUtils::GetCachedChangesets(RepositorySpecification, FromDate, Limit, CachedChangesets);
+			return CachedChangesets;
+		});
+		return;
+	}
+
 	TSharedRef<FPlasticGetChangesets, ESPMode::ThreadSafe> GetChangesetsOperation = ISourceControlOperation::Create<FPlasticGetChangesets>();
-	if (FromDateInDays > -1)
+	GetChangesetsOperation->FromDate = FromDate;
+	GetChangesetsOperation->ChangesetsLimit = ChangesetsLimit;
+
+	Provider.Execute(GetChangesetsOperation, EConcurrency::Asynchronous, FSourceControlOperationComplete::CreateSP(this, &SPlasticSourceControlChangesetsWidget::OnGetChangesetsOperationComplete));
+}
+
+// Only query the changesets older than the ones loaded so far, instead of refreshing them all along with the next page
+void SPlasticSourceControlChangesetsWidget::RequestNextChangesetsPage()
+{
+	if (!ISourceControlModule::Get().IsEnabled() || (!FPlasticSourceControlModule::Get().GetProvider().IsAvailable()))
 	{
-		GetChangesetsOperation->FromDate = FDateTime::Now() - FTimespan::FromDays(FromDateInDays);
+		return;
 	}
 
+	if (SourceControlChangesets.Num() == 0)
+	{
+		RequestChangesetsRefresh();
+		return;
+	}
+
+	StartRefreshStatus();
+
+	bHasMoreChangesets = false; // Until the results of the next page tell otherwise
+
 	FPlasticSourceControlProvider& Provider = FPlasticSourceControlModule::Get().GetProvider();
+	TSharedRef<FPlasticGetChangesets, ESPMode::ThreadSafe> GetChangesetsOperation = ISourceControlOperation::Create<FPlasticGetChangesets>();
+	GetChangesetsOperation->FromDate = GetFromDate();
+	GetChangesetsOperation->ChangesetsLimit = GetDefault<UPlasticSourceControlProjectSettings>()->ChangesetsPageSize;
+	GetChangesetsOperation->BeforeChangesetId = SourceControlChangesets.Last()->ChangesetId;
+
 	Provider.Execute(GetChangesetsOperation, EConcurrency::Asynchronous, FSourceControlOperationComplete::CreateSP(this, &SPlasticSourceControlChangesetsWidget::OnGetChangesetsOperationComplete));
 }
 
@@ -1905,7 +1999,40 @@ void SPlasticSourceControlChangesetsWidget::RequestGetChangesetFiles(const FPlas
 void SPlasticSourceControlChangesetsWidget::OnGetChangesetsOperationComplete(const FSourceControlOperationRef& InOperation, ECommandResult::Type InResult)
 {
 	TSharedRef<FPlasticGetChangesets, ESPMode::ThreadSafe> GetChangesetsOperation = StaticCastSharedRef<FPlasticGetChangesets>(InOperation);
+	if (GetChangesetsOperation->BeforeChangesetId > 0)
+	{
+		// Append the next page, unless the list was refreshed in the meantime
+		if ((SourceControlChangesets.Num() > 0) && (SourceControlChangesets.Last()->ChangesetId == GetChangesetsOperation->BeforeChangesetId))
+		{
+			SourceControlChangesets.Append(MoveTemp(GetChangesetsOperation->Changesets));
+			bHasMoreChangesets = GetChangesetsOperation->bHasMoreChangesets;
+		}
+		// The next refreshes cover the pages loaded so far
+		ChangesetsLimit = FMath::Max(ChangesetsLimit, SourceControlChangesets.Num());
+
+		EndRefreshStatus();
+		OnChangesetsRefreshUI();
+		return;
+	}
+
 	SourceControlChangesets = MoveTemp(GetChangesetsOperation->Changesets);
+	bHasMoreChangesets = GetChangesetsOperation->bHasMoreChangesets;
+	PendingCachedChangesets.Reset(); // Outdated by the results of the operation
+
+	// Forget the files of the changesets no longer listed
+	TSet<int32> ChangesetIds;
+	ChangesetIds.Reserve(SourceControlChangesets.Num());
+	for (const FPlasticSourceControlChangesetRef& Changeset : SourceControlChangesets)
+	{
+		ChangesetIds.Add(Changeset->ChangesetId);
+	}
+	for (auto It = ChangesetsFiles.CreateIterator(); It; ++It)
+	{
+		if (!ChangesetIds.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
 
 	CurrentChangesetId = FPlasticSourceControlModule::Get().GetProvider().GetChangesetNumber();
 
@@ -1916,7 +2043,10 @@ void SPlasticSourceControlChangesetsWidget::OnGetChangesetsOperationComplete(con
 void SPlasticSourceControlChangesetsWidget::OnGetChangesetFilesOperationComplete(const FSourceControlOperationRef& InOperation, ECommandResult::Type InResult)
 {
 	TSharedRef<FPlasticGetChangesetFiles, ESPMode::ThreadSafe> GetChangesetFilesOperation = StaticCastSharedRef<FPlasticGetChangesetFiles>(InOperation);
-	GetChangesetFilesOperation->Changeset->Files = MoveTemp(GetChangesetFilesOperation->Files);
+	if (InResult == ECommandResult::Succeeded)
+	{
+		ChangesetsFiles.Add(GetChangesetFilesOperation->Changeset->ChangesetId, MoveTemp(GetChangesetFilesOperation->Files));
+	}
 
 	EndRefreshStatus();
 	OnFilesRefreshUI();
@@ -2014,7 +2144,7 @@ void SPlasticSourceControlChangesetsWidget::OnSelectionChanged(FPlasticSourceCon
 {
 	SourceSelectedChangeset = InSelectedChangeset;
 
-	if (InSelectedChangeset.IsValid() && SourceSelectedChangeset->Files.Num() == 0)
+	if (InSelectedChangeset.IsValid() && !ChangesetsFiles.Contains(InSelectedChangeset->ChangesetId))
 	{
 		// Asynchronously get the list of files changed in the changeset
 		RequestGetChangesetFiles(SourceSelectedChangeset);
@@ -6,6 +6,7 @@
 
 #include "Notification.h"
 
+#include "Async/Future.h"
 #include "Misc/TextFilter.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Widgets/SCompoundWidget.h"
@@ -87,7 +88,9 @@ private:
 	void TickRefreshStatus(double InDeltaTime);
 	void EndRefreshStatus();
 
+	FDateTime GetFromDate() const;
 	void RequestChangesetsRefresh();
+	void RequestNextChangesetsPage();
 	void RequestGetChangesetFiles(const FPlasticSourceControlChangesetPtr& InSelectedChangeset);
 
 	/** Source control callbacks */
@@ -144,13 +147,27 @@ private:
 	TMap<int32, FText> FromDateInDaysValues;
 	int32 FromDateInDays = 30;
 
-	TArray<FPlasticSourceControlChangesetRef> SourceControlChangesets; // Full list from source (filtered by date)
+	TArray<FPlasticSourceControlChangesetRef> SourceControlChangesets; // List of the newest changesets from source (filtered by date), by descending ids
 	TArray<FPlasticSourceControlChangesetRef> ChangesetRows; // Filtered list to display based on the search text filter
 
+	/** Number of changesets to load, raised by a page each time the end of the list gets into view, see RequestNextChangesetsPage() */
+	int32 ChangesetsLimit = 0;
+	bool bHasMoreChangesets = false;
+
+	/** Number of pages loaded in a row while the search text filters out all the changesets, to stop loading them after a few, see Tick() */
+	int32 NumPagesWithoutMatch = 0;
+
+	/** Changesets cached by the previous session, loaded on a background thread to be displayed before the first refresh, see RequestChangesetsRefresh() */
+	TFuture<TArray<FPlasticSourceControlChangesetRef>> PendingCachedChangesets;
+	bool bCachedChangesetsRequested = false;
+
 	TSharedPtr<SListView<FPlasticSourceControlStateRef>> FilesListView;
 	TSharedPtr<TTextFilter<const FPlasticSourceControlState&>> FilesSearchTextFilter;
 
-	FPlasticSourceControlChangesetPtr SourceSelectedChangeset; // Current selected changeset from source control if any, with full list of files
+	FPlasticSourceControlChangesetPtr SourceSelectedChangeset; // Current selected changeset from source control if any
+
+	/** Files of the changesets already selected, kept out of the changeset objects since these are shared with the cache of changesets, see RequestGetChangesetFiles() */
+	TMap<int32, TArray<FPlasticSourceControlStateRef>> ChangesetsFiles;
 	TArray<FPlasticSourceControlStateRef> FileRows; // Filtered list to display based on the search text filter
 
 	/** Delegate handle for the HandleSourceControlStateChanged function callback */
@@ -13,6 +13,7 @@
 
 #include "ISourceControlModule.h"
 
+#include "Async/Async.h"
 #include "Logging/MessageLog.h"
 #include "ToolMenus.h"
 #include "ToolMenuContext.h"
@@ -30,6 +31,7 @@
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SExpandableArea.h"
 #include "Widgets/Layout/SSpacer.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Views/SHeaderRow.h"
@@ -47,8 +49,8 @@ void SPlasticSourceControlLocksWidget::Construct(const FArguments& InArgs)
 
 	const FString OrganizationName = FPlasticSourceControlModule::Get().GetProvider().GetCloudOrganization();
 
-	SearchTextFilter = MakeShared<TTextFilter<const FPlasticSourceControlLock&>>(TTextFilter<const FPlasticSourceControlLock&>::FItemToStringArray::CreateSP(this, &SPlasticSourceControlLocksWidget::PopulateItemSearchStrings));
-	SearchTextFilter->OnChanged().AddSP(this, &SPlasticSourceControlLocksWidget::OnRefreshUI);
+	SearchTextFilter = MakeShared<TTextFilter<const FPlasticSourceControlLock&>>(TTextFilter<const FPlasticSourceControlLock&>::FItemToStringArray::CreateStatic(&PopulateLockSearchStrings));
+	SearchTextFilter->OnChanged().AddSP(this, &SPlasticSourceControlLocksWidget::UpdateRows, false);
 
 	ChildSlot
 	[
@@ -140,6 +142,11 @@ void SPlasticSourceControlLocksWidget::Construct(const FArguments& InArgs)
 				]
 			]
 		]
+		+SVerticalBox::Slot() // Summary of the locks by owner, branch, folder and age (collapsed by default)
+		.AutoHeight()
+		[
+			CreateSummaryPanel()
+		]
 		+SVerticalBox::Slot() // The main content: the list of locks
 		[
 			SNew(SVerticalBox)
@@ -211,6 +218,51 @@ TSharedRef<SWidget> SPlasticSourceControlLocksWidget::CreateToolBar()
 	return ToolBarBuilder.MakeWidget();
 }
 
+TSharedRef<SWidget> SPlasticSourceControlLocksWidget::CreateSummaryPanel()
+{
+	UpdateSummary();
+
+	return SNew(SExpandableArea)
+		.InitiallyCollapsed(true)
+		.HeaderContent()
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this]() { return SummaryTitleText; })
+		]
+		.BodyContent()
+		[
+			SNew(SHorizontalBox)
+			+SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(4.0f)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]() { return SummaryOwnersText; })
+			]
+			+SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(4.0f)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]() { return SummaryBranchesText; })
+			]
+			+SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(4.0f)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]() { return SummaryFoldersText; })
+			]
+			+SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(4.0f)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]() { return SummaryAgesText; })
+			]
+		];
+}
+
 TSharedRef<SWidget> SPlasticSourceControlLocksWidget::CreateContentPanel()
 {
 	// Inspired by Engine\Source\Editor\SourceControlWindows\Private\SSourceControlChangelists.cpp
@@ -362,243 +414,449 @@ void SPlasticSourceControlLocksWidget::OnHiddenColumnsListChanged()
 	}
 }
 
-void SPlasticSourceControlLocksWidget::OnSearchTextChanged(const FText& InFilterText)
+// Number of locks above which the rows are sorted and filtered on a background thread, to keep the window responsive
+static const int32 MinNumLocksForBackgroundUpdate = 10000;
+
+static void PopulateLockSearchStrings(const FPlasticSourceControlLock& InItem, TArray<FString>& OutStrings)
 {
-	SearchTextFilter->SetRawFilterText(InFilterText);
-	LockSearchBox->SetError(SearchTextFilter->GetFilterErrorText());
+	InItem.PopulateSearchString(OutStrings);
 }
 
-void SPlasticSourceControlLocksWidget::PopulateItemSearchStrings(const FPlasticSourceControlLock& InItem, TArray<FString>& OutStrings)
+typedef int32 (*FCompareLocksFunc)(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs);
+
+static int32 CompareItemIds(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
 {
-	InItem.PopulateSearchString(OutStrings);
+	return Lhs.ItemId < Rhs.ItemId ? -1 : (Lhs.ItemId == Rhs.ItemId ? 0 : 1);
+}
+
+static int32 CompareStatuses(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
+{
+	return FCString::Stricmp(*Lhs.Status, *Rhs.Status);
+}
+
+static int32 ComparePaths(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
+{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	return UE::ComparisonUtility::CompareNaturalOrder(*Lhs.Path, *Rhs.Path);
+#else
+	return FCString::Stricmp(*Lhs.Path, *Rhs.Path);
+#endif
 }
 
-void SPlasticSourceControlLocksWidget::OnRefreshUI()
+static int32 CompareOwners(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::OnRefreshUI);
+	return FCString::Stricmp(*Lhs.Owner, *Rhs.Owner);
+}
 
-	const int32 ItemCount = SourceControlLocks.Num();
-	LockRows.Empty(ItemCount);
-	for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
+static int32 CompareDestinationBranches(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
+{
+	return FCString::Stricmp(*Lhs.DestinationBranch, *Rhs.DestinationBranch);
+}
+
+static int32 CompareBranches(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
+{
+	return FCString::Stricmp(*Lhs.Branch, *Rhs.Branch);
+}
+
+static int32 CompareWorkspaces(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
+{
+	return FCString::Stricmp(*Lhs.Workspace, *Rhs.Workspace);
+}
+
+static int32 CompareDates(const FPlasticSourceControlLock& Lhs, const FPlasticSourceControlLock& Rhs)
+{
+	return Lhs.Date < Rhs.Date ? -1 : (Lhs.Date == Rhs.Date ? 0 : 1);
+}
+
+static FCompareLocksFunc GetCompareLocksFunc(const FName& InColumnId)
+{
+	if (InColumnId == PlasticSourceControlLocksListViewColumn::ItemId::Id())
 	{
-		const FPlasticSourceControlLockRef& Item = SourceControlLocks[ItemIndex];
-		if (SearchTextFilter->PassesFilter(Item.Get()))
+		return &CompareItemIds;
+	}
+	else if (InColumnId == PlasticSourceControlLocksListViewColumn::Status::Id())
+	{
+		return &CompareStatuses;
+	}
+	else if (InColumnId == PlasticSourceControlLocksListViewColumn::Path::Id())
+	{
+		return &ComparePaths;
+	}
+	else if (InColumnId == PlasticSourceControlLocksListViewColumn::Owner::Id())
+	{
+		return &CompareOwners;
+	}
+	else if (InColumnId == PlasticSourceControlLocksListViewColumn::DestinationBranch::Id())
+	{
+		return &CompareDestinationBranches;
+	}
+	else if (InColumnId == PlasticSourceControlLocksListViewColumn::Branch::Id())
+	{
+		return &CompareBranches;
+	}
+	else if (InColumnId == PlasticSourceControlLocksListViewColumn::Workspace::Id())
+	{
+		return &CompareWorkspaces;
+	}
+	else if (InColumnId == PlasticSourceControlLocksListViewColumn::Date::Id())
+	{
+		return &CompareDates;
+	}
+	else
+	{
+		checkNoEntry();
+		return nullptr;
+	}
+}
+
+// Sort order of the view, as a predicate captured by value so that it can also be used by a background task
+struct FLocksSortOrder
+{
+	FLocksSortOrder(const FName& InPrimaryColumn, const EColumnSortMode::Type InPrimaryMode, const FName& InSecondaryColumn, const EColumnSortMode::Type InSecondaryMode)
+		: PrimaryCompare(InPrimaryColumn.IsNone() ? nullptr : GetCompareLocksFunc(InPrimaryColumn))
+		, SecondaryCompare(InSecondaryColumn.IsNone() ? nullptr : GetCompareLocksFunc(InSecondaryColumn))
+		, bPrimaryAscending(InPrimaryMode == EColumnSortMode::Ascending)
+		, bSecondaryAscending(InSecondaryMode == EColumnSortMode::Ascending)
+	{
+	}
+
+	bool IsSorted() const
+	{
+		return PrimaryCompare != nullptr;
+	}
+
+	bool operator()(const FPlasticSourceControlLockRef& Lhs, const FPlasticSourceControlLockRef& Rhs) const
+	{
+		const int32 Result = PrimaryCompare(Lhs.Get(), Rhs.Get());
+		if (Result != 0 || !SecondaryCompare)
 		{
-			LockRows.Emplace(Item);
+			return bPrimaryAscending ? (Result < 0) : (Result > 0);
 		}
+		const int32 SecondaryResult = SecondaryCompare(Lhs.Get(), Rhs.Get());
+		return bSecondaryAscending ? (SecondaryResult < 0) : (SecondaryResult > 0);
 	}
 
-	if (GetListView())
+	FCompareLocksFunc PrimaryCompare;
+	FCompareLocksFunc SecondaryCompare;
+	bool bPrimaryAscending;
+	bool bSecondaryAscending;
+};
+
+static TArray<FPlasticSourceControlLockRef> FilterLocks(const TArray<FPlasticSourceControlLockRef>& InLocks, const TTextFilter<const FPlasticSourceControlLock&>& InTextFilter)
+{
+	TArray<FPlasticSourceControlLockRef> Rows;
+	Rows.Reserve(InLocks.Num());
+	for (const FPlasticSourceControlLockRef& Lock : InLocks)
 	{
-		SortLockView();
-		GetListView()->RequestListRefresh();
+		if (InTextFilter.PassesFilter(Lock.Get()))
+		{
+			Rows.Add(Lock);
+		}
 	}
+	return Rows;
 }
 
-EColumnSortPriority::Type SPlasticSourceControlLocksWidget::GetColumnSortPriority(const FName InColumnId) const
+// Merge some new locks into an array of locks already in the sort order of the view, in a single pass
+static void MergeSortedLocks(TArray<FPlasticSourceControlLockRef>& InOutLocks, TArray<FPlasticSourceControlLockRef>&& InNewLocks, const FLocksSortOrder& InSortOrder)
 {
-	if (InColumnId == PrimarySortedColumn)
+	if (!InSortOrder.IsSorted() || InNewLocks.Num() == 0)
 	{
-		return EColumnSortPriority::Primary;
+		InOutLocks.Append(MoveTemp(InNewLocks));
+		return;
 	}
-	else if (InColumnId == SecondarySortedColumn)
+
+	InNewLocks.Sort(InSortOrder);
+
+	TArray<FPlasticSourceControlLockRef> MergedLocks;
+	MergedLocks.Reserve(InOutLocks.Num() + InNewLocks.Num());
+	int32 LockIndex = 0;
+	int32 NewLockIndex = 0;
+	while (LockIndex < InOutLocks.Num() && NewLockIndex < InNewLocks.Num())
 	{
-		return EColumnSortPriority::Secondary;
+		if (InSortOrder(InNewLocks[NewLockIndex], InOutLocks[LockIndex]))
+		{
+			MergedLocks.Add(InNewLocks[NewLockIndex++]);
+		}
+		else
+		{
+			MergedLocks.Add(InOutLocks[LockIndex++]);
+		}
 	}
-
-	return EColumnSortPriority::Max; // No specific priority.
+	while (LockIndex < InOutLocks.Num())
+	{
+		MergedLocks.Add(InOutLocks[LockIndex++]);
+	}
+	while (NewLockIndex < InNewLocks.Num())
+	{
+		MergedLocks.Add(InNewLocks[NewLockIndex++]);
+	}
+	InOutLocks = MoveTemp(MergedLocks);
 }
 
-EColumnSortMode::Type SPlasticSourceControlLocksWidget::GetColumnSortMode(const FName InColumnId) const
+// Whether the locks passing the new filter text are a subset of the ones passing the previous one, so that the previous rows only need to be narrowed down.
+// This is the case when the text has only been extended, as long as it contains no operator that could widen the results (OR, NOT, exclusion, quotes...)
+static bool IsNarrowingFilterText(const FString& InPreviousFilterText, const FString& InFilterText)
 {
-	if (InColumnId == PrimarySortedColumn)
+	if (!InFilterText.StartsWith(InPreviousFilterText, ESearchCase::CaseSensitive))
 	{
-		return PrimarySortMode;
+		return false;
 	}
-	else if (InColumnId == SecondarySortedColumn)
+
+	for (const TCHAR Char : InFilterText)
 	{
-		return SecondarySortMode;
+		if (!FChar::IsAlnum(Char) && !FChar::IsWhitespace(Char) && (Char != TEXT('/')) && (Char != TEXT('_')) && (Char != TEXT('.')))
+		{
+			return false;
+		}
 	}
 
-	return EColumnSortMode::None;
+	TArray<FString> Terms;
+	InFilterText.ParseIntoArrayWS(Terms);
+	for (const FString& Term : Terms)
+	{
+		if (Term.Equals(TEXT("OR"), ESearchCase::IgnoreCase) || Term.Equals(TEXT("AND"), ESearchCase::IgnoreCase) || Term.Equals(TEXT("NOT"), ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+	}
+
+	return true;
 }
 
-void SPlasticSourceControlLocksWidget::OnColumnSortModeChanged(const EColumnSortPriority::Type InSortPriority, const FName& InColumnId, const EColumnSortMode::Type InSortMode)
+void SPlasticSourceControlLocksWidget::OnSearchTextChanged(const FText& InFilterText)
 {
-	if (InSortPriority == EColumnSortPriority::Primary)
+	SearchTextFilter->SetRawFilterText(InFilterText);
+	LockSearchBox->SetError(SearchTextFilter->GetFilterErrorText());
+}
+
+void SPlasticSourceControlLocksWidget::UpdateRows(const bool bInSortLocks)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::UpdateRows);
+
+	bLocksSortPending |= bInSortLocks;
+
+	const FString FilterText = SearchTextFilter->GetRawFilterText().ToString();
+	const FLocksSortOrder SortOrder(PrimarySortedColumn, PrimarySortMode, SecondarySortedColumn, SecondarySortMode);
+
+	// Narrow down the current rows if they are up to date and the search text has only been extended, else filter the full list of locks
+	const bool bNarrowRows = !bLocksSortPending && !PendingRowsUpdate.IsValid() && IsNarrowingFilterText(RowsFilterText, FilterText);
+	const TArray<FPlasticSourceControlLockRef>& CandidateLocks = bNarrowRows ? LockRows : SourceControlLocks;
+
+	if (CandidateLocks.Num() < MinNumLocksForBackgroundUpdate)
 	{
-		PrimarySortedColumn = InColumnId;
-		PrimarySortMode = InSortMode;
+		// Discard any background update still in progress, its results being older
+		PendingRowsUpdate.Reset();
 
-		if (InColumnId == SecondarySortedColumn) // Cannot be primary and secondary at the same time.
+		if (bLocksSortPending && SortOrder.IsSorted())
 		{
-			SecondarySortedColumn = FName();
-			SecondarySortMode = EColumnSortMode::None;
+			// NOTE: StableSort() would give a better experience when the sorted columns(s) has the same values and new values gets added, but it is slower
+			//       with large changelists (7600 items was about 1.8x slower in average measured with Unreal Insight). Because this code runs in the main
+			//       thread and can be invoked a lot, the trade off went if favor of speed.
+			SourceControlLocks.Sort(SortOrder);
+		}
+		bLocksSortPending = false;
+
+		// The full list being kept in the sort order of the view, filtering it keeps the rows sorted
+		LockRows = FilterLocks(CandidateLocks, *SearchTextFilter);
+		RowsFilterText = FilterText;
+
+		if (GetListView())
+		{
+			GetListView()->RequestListRefresh();
 		}
+		return;
 	}
-	else if (InSortPriority == EColumnSortPriority::Secondary)
+
+	// Sort and filter a copy of the locks on a background thread, the previous rows staying displayed until the results are applied by Tick().
+	// Note: the locks themselves are immutable and shared with the cache, and this task uses a text filter of its own.
+	PendingRowsUpdate = Async(EAsyncExecution::ThreadPool, [Locks = CandidateLocks, bSortLocks = bLocksSortPending, bNarrowRows, SortOrder, FilterText]() mutable -> TSharedPtr<FLockRowsUpdate, ESPMode::ThreadSafe>
 	{
-		SecondarySortedColumn = InColumnId;
-		SecondarySortMode = InSortMode;
+		TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::UpdateRowsTask);
+
+		if (bSortLocks && SortOrder.IsSorted())
+		{
+			Locks.Sort(SortOrder);
+		}
+
+		TTextFilter<const FPlasticSourceControlLock&> TextFilter(TTextFilter<const FPlasticSourceControlLock&>::FItemToStringArray::CreateStatic(&PopulateLockSearchStrings));
+		TextFilter.SetRawFilterText(FText::FromString(FilterText));
+
+		TSharedPtr<FLockRowsUpdate, ESPMode::ThreadSafe> Update = MakeShared<FLockRowsUpdate, ESPMode::ThreadSafe>();
+		Update->Rows = FilterLocks(Locks, TextFilter);
+		Update->FilterText = MoveTemp(FilterText);
+		Update->bNarrowedRows = bNarrowRows;
+		if (!bNarrowRows)
+		{
+			Update->SortedLocks = MoveTemp(Locks);
+		}
+		return Update;
+	});
+}
+
+void SPlasticSourceControlLocksWidget::OnRowsUpdated(FLockRowsUpdate& InUpdate)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::OnRowsUpdated);
+
+	if (!InUpdate.bNarrowedRows)
+	{
+		SourceControlLocks = MoveTemp(InUpdate.SortedLocks);
 	}
+	bLocksSortPending = false;
+	LockRows = MoveTemp(InUpdate.Rows);
+	RowsFilterText = MoveTemp(InUpdate.FilterText);
 
 	if (GetListView())
 	{
-		SortLockView();
 		GetListView()->RequestListRefresh();
 	}
 }
 
-void SPlasticSourceControlLocksWidget::SortLockView()
+void SPlasticSourceControlLocksWidget::OnLocksChanged(const FPlasticSourceControlLocksChanges& InChanges)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::SortLockView);
+	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::OnLocksChanged);
 
-	if (PrimarySortedColumn.IsNone() || LockRows.Num() == 0)
+	// Only replace the rows of the locks that changed, so that the list view keeps the widgets of all the other rows
+	TSet<const FPlasticSourceControlLock*> StaleLocks;
+	StaleLocks.Reserve(InChanges.Removed.Num() + InChanges.Replaced.Num());
+	for (const FPlasticSourceControlLockRef& Lock : InChanges.Removed)
 	{
-		return; // No column selected for sorting or nothing to sort.
+		StaleLocks.Add(&Lock.Get());
 	}
-
-	auto CompareItemIds = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
+	for (const FPlasticSourceControlLockRef& Lock : InChanges.Replaced)
 	{
-		return Lhs->ItemId < Rhs->ItemId ? -1 : (Lhs->ItemId == Rhs->ItemId ? 0 : 1);
-	};
-
-	auto CompareStatuses = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
+		StaleLocks.Add(&Lock.Get());
+	}
+	if (StaleLocks.Num() > 0)
 	{
-		return FCString::Stricmp(*Lhs->Status, *Rhs->Status);
-	};
+		auto IsStale = [&StaleLocks](const FPlasticSourceControlLockRef& InLock) { return StaleLocks.Contains(&InLock.Get()); };
+		SourceControlLocks.RemoveAll(IsStale);
+		LockRows.RemoveAll(IsStale);
+	}
 
-	auto ComparePaths = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
-	{
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		return UE::ComparisonUtility::CompareNaturalOrder(*Lhs->Path, *Rhs->Path);
-#else
-		return FCString::Stricmp(*Lhs->Path, *Rhs->Path);
-#endif
-	};
+	TArray<FPlasticSourceControlLockRef> NewLocks;
+	NewLocks.Reserve(InChanges.Added.Num() + InChanges.Changed.Num());
+	NewLocks.Append(InChanges.Added);
+	NewLocks.Append(InChanges.Changed);
 
-	auto CompareOwners = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
+	TArray<FPlasticSourceControlLockRef> NewRows = FilterLocks(NewLocks, *SearchTextFilter);
+
+	// Keep both lists in the sort order of the view, merging the new locks in instead of sorting everything again
+	const FLocksSortOrder SortOrder(PrimarySortedColumn, PrimarySortMode, SecondarySortedColumn, SecondarySortMode);
+	MergeSortedLocks(SourceControlLocks, MoveTemp(NewLocks), SortOrder);
+	MergeSortedLocks(LockRows, MoveTemp(NewRows), SortOrder);
+
+	if (GetListView())
 	{
-		return FCString::Stricmp(*Lhs->Owner, *Rhs->Owner);
-	};
+		GetListView()->RequestListRefresh();
+	}
+}
 
-	auto CompareDestinationBranches = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
+// Number of groups listed by owner, by branch and by folder in the summary panel
+static const int32 NumSummaryGroups = 5;
+
+static FText FormatSummaryCount(const FText& InName, const FPlasticSourceControlLocksSummary::FCount& InCount)
+{
+	if (InCount.NumRetained > 0)
 	{
-		return FCString::Stricmp(*Lhs->DestinationBranch, *Rhs->DestinationBranch);
-	};
+		return FText::Format(LOCTEXT("LocksSummary_CountWithRetained", "{0}: {1} ({2} retained)"), InName, FText::AsNumber(InCount.Num), FText::AsNumber(InCount.NumRetained));
+	}
+	return FText::Format(LOCTEXT("LocksSummary_Count", "{0}: {1}"), InName, FText::AsNumber(InCount.Num));
+}
 
-	auto CompareBranches = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
+static FText FormatSummaryLargestCounts(const FText& InTitle, const TMap<FString, FPlasticSourceControlLocksSummary::FCount>& InCounts)
+{
+	TArray<FText> Lines;
+	Lines.Add(InTitle);
+	for (const TPair<FString, FPlasticSourceControlLocksSummary::FCount>& Count : FPlasticSourceControlLocksSummary::GetLargestCounts(InCounts, NumSummaryGroups))
 	{
-		return FCString::Stricmp(*Lhs->Branch, *Rhs->Branch);
-	};
+		Lines.Add(FormatSummaryCount(FText::FromString(Count.Key), Count.Value));
+	}
+	return FText::Join(FText::FromString(TEXT("\n")), Lines);
+}
 
-	auto CompareWorkspaces = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
+void SPlasticSourceControlLocksWidget::UpdateSummary()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::UpdateSummary);
+
+	if (!LocksIndex.IsValid())
 	{
-		return FCString::Stricmp(*Lhs->Workspace, *Rhs->Workspace);
-	};
+		SummaryTitleText = LOCTEXT("LocksSummary_Title", "Summary");
+		SummaryOwnersText = SummaryBranchesText = SummaryFoldersText = SummaryAgesText = FText::GetEmpty();
+		return;
+	}
+
+	// Note: only the largest groups are sorted and formatted here, the counts themselves being updated incrementally with each list of locks
+	const FPlasticSourceControlLocksSummary& Summary = LocksIndex->GetSummary();
+	SummaryTitleText = FText::Format(LOCTEXT("LocksSummary_TitleWithTotal", "Summary of {0} lock(s), {1} retained"), FText::AsNumber(Summary.GetTotal().Num), FText::AsNumber(Summary.GetTotal().NumRetained));
+	SummaryOwnersText = FormatSummaryLargestCounts(LOCTEXT("LocksSummary_Owners", "Owners with the most locks"), Summary.GetCountsByOwner());
+	SummaryBranchesText = FormatSummaryLargestCounts(LOCTEXT("LocksSummary_Branches", "Branches with the most locks"), Summary.GetCountsByBranch());
+	SummaryFoldersText = FormatSummaryLargestCounts(LOCTEXT("LocksSummary_Folders", "Folders with the most locks"), Summary.GetCountsByFolder());
 
-	auto CompareDates = [](const FPlasticSourceControlLock* Lhs, const FPlasticSourceControlLock* Rhs)
+	const FText AgeNames[] =
 	{
-		return Lhs->Date < Rhs->Date ? -1 : (Lhs->Date == Rhs->Date ? 0 : 1);
+		LOCTEXT("LocksSummary_LessThanADay", "Less than a day"),
+		LOCTEXT("LocksSummary_LessThanAWeek", "Less than a week"),
+		LOCTEXT("LocksSummary_LessThanAMonth", "Less than a month"),
+		LOCTEXT("LocksSummary_MoreThanAMonth", "More than a month")
 	};
+	const TArray<FPlasticSourceControlLocksSummary::FCount> CountsByAge = Summary.GetCountsByAge(FDateTime::Now());
+	TArray<FText> AgeLines;
+	AgeLines.Add(LOCTEXT("LocksSummary_Ages", "Age of the locks"));
+	for (int32 AgeIndex = 0; AgeIndex < CountsByAge.Num(); AgeIndex++)
+	{
+		AgeLines.Add(FormatSummaryCount(AgeNames[AgeIndex], CountsByAge[AgeIndex]));
+	}
+	SummaryAgesText = FText::Join(FText::FromString(TEXT("\n")), AgeLines);
+}
 
-	auto GetCompareFunc = [&](const FName& ColumnId)
+EColumnSortPriority::Type SPlasticSourceControlLocksWidget::GetColumnSortPriority(const FName InColumnId) const
+{
+	if (InColumnId == PrimarySortedColumn)
 	{
-		if (ColumnId == PlasticSourceControlLocksListViewColumn::ItemId::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(CompareItemIds);
-		}
-		else if (ColumnId == PlasticSourceControlLocksListViewColumn::Status::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(CompareStatuses);
-		}
-		else if (ColumnId == PlasticSourceControlLocksListViewColumn::Path::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(ComparePaths);
-		}
-		else if (ColumnId == PlasticSourceControlLocksListViewColumn::Owner::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(CompareOwners);
-		}
-		else if (ColumnId == PlasticSourceControlLocksListViewColumn::DestinationBranch::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(CompareDestinationBranches);
-		}
-		else if (ColumnId == PlasticSourceControlLocksListViewColumn::Branch::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(CompareBranches);
-		}
-		else if (ColumnId == PlasticSourceControlLocksListViewColumn::Workspace::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(CompareWorkspaces);
-		}
-		else if (ColumnId == PlasticSourceControlLocksListViewColumn::Date::Id())
-		{
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>(CompareDates);
-		}
-		else
-		{
-			checkNoEntry();
-			return TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)>();
-		};
-	};
+		return EColumnSortPriority::Primary;
+	}
+	else if (InColumnId == SecondarySortedColumn)
+	{
+		return EColumnSortPriority::Secondary;
+	}
+
+	return EColumnSortPriority::Max; // No specific priority.
+}
 
-	TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)> PrimaryCompare = GetCompareFunc(PrimarySortedColumn);
-	TFunction<int32(const FPlasticSourceControlLock*, const FPlasticSourceControlLock*)> SecondaryCompare;
-	if (!SecondarySortedColumn.IsNone())
+EColumnSortMode::Type SPlasticSourceControlLocksWidget::GetColumnSortMode(const FName InColumnId) const
+{
+	if (InColumnId == PrimarySortedColumn)
 	{
-		SecondaryCompare = GetCompareFunc(SecondarySortedColumn);
+		return PrimarySortMode;
+	}
+	else if (InColumnId == SecondarySortedColumn)
+	{
+		return SecondarySortMode;
 	}
 
-	if (PrimarySortMode == EColumnSortMode::Ascending)
+	return EColumnSortMode::None;
+}
+
+void SPlasticSourceControlLocksWidget::OnColumnSortModeChanged(const EColumnSortPriority::Type InSortPriority, const FName& InColumnId, const EColumnSortMode::Type InSortMode)
+{
+	if (InSortPriority == EColumnSortPriority::Primary)
 	{
-		// NOTE: StableSort() would give a better experience when the sorted columns(s) has the same values and new values gets added, but it is slower
-		//       with large changelists (7600 items was about 1.8x slower in average measured with Unreal Insight). Because this code runs in the main
-		//       thread and can be invoked a lot, the trade off went if favor of speed.
-		LockRows.Sort([this, &PrimaryCompare, &SecondaryCompare](const FPlasticSourceControlLockPtr& Lhs, const FPlasticSourceControlLockPtr& Rhs)
+		PrimarySortedColumn = InColumnId;
+		PrimarySortMode = InSortMode;
+
+		if (InColumnId == SecondarySortedColumn) // Cannot be primary and secondary at the same time.
 		{
-			int32 Result = PrimaryCompare(static_cast<FPlasticSourceControlLock*>(Lhs.Get()), static_cast<FPlasticSourceControlLock*>(Rhs.Get()));
-			if (Result < 0)
-			{
-				return true;
-			}
-			else if (Result > 0 || !SecondaryCompare)
-			{
-				return false;
-			}
-			else if (SecondarySortMode == EColumnSortMode::Ascending)
-			{
-				return SecondaryCompare(static_cast<FPlasticSourceControlLock*>(Lhs.Get()), static_cast<FPlasticSourceControlLock*>(Rhs.Get())) < 0;
-			}
-			else
-			{
-				return SecondaryCompare(static_cast<FPlasticSourceControlLock*>(Lhs.Get()), static_cast<FPlasticSourceControlLock*>(Rhs.Get())) > 0;
-			}
-		});
+			SecondarySortedColumn = FName();
+			SecondarySortMode = EColumnSortMode::None;
+		}
 	}
-	else
+	else if (InSortPriority == EColumnSortPriority::Secondary)
 	{
-		LockRows.Sort([this, &PrimaryCompare, &SecondaryCompare](const FPlasticSourceControlLockPtr& Lhs, const FPlasticSourceControlLockPtr& Rhs)
-		{
-			int32 Result = PrimaryCompare(static_cast<FPlasticSourceControlLock*>(Lhs.Get()), static_cast<FPlasticSourceControlLock*>(Rhs.Get()));
-			if (Result > 0)
-			{
-				return true;
-			}
-			else if (Result < 0 || !SecondaryCompare)
-			{
-				return false;
-			}
-			else if (SecondarySortMode == EColumnSortMode::Ascending)
-			{
-				return SecondaryCompare(static_cast<FPlasticSourceControlLock*>(Lhs.Get()), static_cast<FPlasticSourceControlLock*>(Rhs.Get())) < 0;
-			}
-			else
-			{
-				return SecondaryCompare(static_cast<FPlasticSourceControlLock*>(Lhs.Get()), static_cast<FPlasticSourceControlLock*>(Rhs.Get())) > 0;
-			}
-		});
+		SecondarySortedColumn = InColumnId;
+		SecondarySortMode = InSortMode;
 	}
+
+	UpdateRows(true);
 }
 
 TSharedPtr<SWidget> SPlasticSourceControlLocksWidget::OnOpenContextMenu()
@@ -708,7 +966,7 @@ void SPlasticSourceControlLocksWidget::ExecuteUnlock(TArray<FPlasticSourceContro
 			if (Result == ECommandResult::Succeeded)
 			{
 				// Display an ongoing notification during the whole operation (packages will be reloaded at the completion of the operation)
-				Notification.DisplayInProgress(UnlockOperation->GetInProgressString());
+				Notification.DisplayInProgress(TAttribute<FText>::CreateLambda([UnlockOperation]() { return UnlockOperation->GetInProgressString(); }));
 				StartRefreshStatus();
 			}
 			else
@@ -749,6 +1007,13 @@ void SPlasticSourceControlLocksWidget::Tick(const FGeometry& AllottedGeometry, c
 		bShouldInvalidateLocksCache = false;
 	}
 
+	if (PendingRowsUpdate.IsValid() && PendingRowsUpdate.IsReady())
+	{
+		const TSharedPtr<FLockRowsUpdate, ESPMode::ThreadSafe> Update = PendingRowsUpdate.Get();
+		PendingRowsUpdate.Reset();
+		OnRowsUpdated(*Update);
+	}
+
 	if (bIsRefreshing)
 	{
 		TickRefreshStatus(InDeltaTime);
@@ -801,17 +1066,50 @@ void SPlasticSourceControlLocksWidget::OnGetLocksOperationComplete(const FSource
 	TRACE_CPUPROFILER_EVENT_SCOPE(SPlasticSourceControlLocksWidget::OnGetLocksOperationComplete);
 
 	TSharedRef<FPlasticGetLocks, ESPMode::ThreadSafe> OperationGetLocks = StaticCastSharedRef<FPlasticGetLocks>(InOperation);
-	SourceControlLocks = MoveTemp(OperationGetLocks->Locks);
+	const FPlasticSourceControlLocksIndexPtr PreviousLocksIndex = LocksIndex;
+	LocksIndex = OperationGetLocks->LocksIndex;
 
 	WorkspaceSelector = FPlasticSourceControlModule::Get().GetProvider().GetWorkspaceSelector();
 
 	EndRefreshStatus();
-	OnRefreshUI();
+
+	// Note: formatted again even for the same locks, since they get older
+	UpdateSummary();
+
+	if (!LocksIndex.IsValid())
+	{
+		SourceControlLocks.Reset();
+		UpdateRows(false);
+	}
+	else if (LocksIndex == PreviousLocksIndex)
+	{
+		// The locks came from the cache, and are the ones already displayed
+	}
+	else if (PreviousLocksIndex.IsValid() && (LocksIndex->GetPreviousSerial() == PreviousLocksIndex->GetSerial()))
+	{
+		// The new list was compared with the one displayed: only update the rows of the locks that changed
+		const FPlasticSourceControlLocksChanges& Changes = LocksIndex->GetChanges();
+		if (PendingRowsUpdate.IsValid() || bLocksSortPending || (Changes.Added.Num() + Changes.Changed.Num() >= MinNumLocksForBackgroundUpdate))
+		{
+			// The rows are being updated in the background, or there are too many changes to merge them here
+			SourceControlLocks = LocksIndex->GetLocks();
+			UpdateRows(true);
+		}
+		else if (!Changes.IsEmpty())
+		{
+			OnLocksChanged(Changes);
+		}
+	}
+	else
+	{
+		SourceControlLocks = LocksIndex->GetLocks();
+		UpdateRows(true);
+	}
 }
 
 void SPlasticSourceControlLocksWidget::OnUnlockOperationComplete(const FSourceControlOperationRef& InOperation, ECommandResult::Type InResult)
 {
-	// Ask for a full refresh of the list of locks (and don't call EndRefreshStatus() yet)
+	// Ask for a refresh of the list of locks, served by the cache updated with the results of the operation (and don't call EndRefreshStatus() yet)
 	bShouldRefresh = true;
 
 	Notification.RemoveInProgress();
@@ -826,7 +1124,11 @@ void SPlasticSourceControlLocksWidget::OnSourceControlProviderChanged(ISourceCon
 
 	if (&NewProvider != &OldProvider)
 	{
+		LocksIndex.Reset();
+		SourceControlLocks.Reset();
 		LockRows.Reset();
+		PendingRowsUpdate.Reset();
+		UpdateSummary();
 		if (GetListView())
 		{
 			GetListView()->RequestListRefresh();
@@ -6,6 +6,7 @@
 
 #include "Notification.h"
 
+#include "Async/Future.h"
 #include "Misc/TextFilter.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Widgets/SCompoundWidget.h"
@@ -15,6 +16,7 @@
 #include "ISourceControlProvider.h"
 
 typedef TSharedRef<class FPlasticSourceControlLock, ESPMode::ThreadSafe> FPlasticSourceControlLockRef;
+typedef TSharedPtr<const class FPlasticSourceControlLocksIndex, ESPMode::ThreadSafe> FPlasticSourceControlLocksIndexPtr;
 
 class SSearchBox;
 
@@ -31,21 +33,32 @@ class SPlasticSourceControlLocksWidget : public SCompoundWidget
 private:
 	TSharedRef<SWidget> CreateToolBar();
 	TSharedRef<SWidget> CreateContentPanel();
+	TSharedRef<SWidget> CreateSummaryPanel();
 
 	TSharedRef<ITableRow> OnGenerateRow(FPlasticSourceControlLockRef InLock, const TSharedRef<STableViewBase>& OwnerTable);
 	void OnHiddenColumnsListChanged();
 
 	void OnSearchTextChanged(const FText& InFilterText);
-	void PopulateItemSearchStrings(const FPlasticSourceControlLock& InItem, TArray<FString>& OutStrings);
 
-	void OnRefreshUI();
+	/** Results of sorting and filtering the locks on a background thread, see UpdateRows() */
+	struct FLockRowsUpdate
+	{
+		TArray<FPlasticSourceControlLockRef> SortedLocks;
+		TArray<FPlasticSourceControlLockRef> Rows;
+		FString FilterText;
+		bool bNarrowedRows = false;
+	};
+
+	void UpdateRows(const bool bInSortLocks);
+	void OnRowsUpdated(FLockRowsUpdate& InUpdate);
+	void OnLocksChanged(const class FPlasticSourceControlLocksChanges& InChanges);
+
+	void UpdateSummary();
 
 	EColumnSortPriority::Type GetColumnSortPriority(const FName InColumnId) const;
 	EColumnSortMode::Type GetColumnSortMode(const FName InColumnId) const;
 	void OnColumnSortModeChanged(const EColumnSortPriority::Type InSortPriority, const FName& InColumnId, const EColumnSortMode::Type InSortMode);
 
-	void SortLockView();
-
 	TSharedPtr<SWidget> OnOpenContextMenu();
 
 	FReply OnConfigureLockRulesClicked(const FString InOrganizationName);
@@ -102,8 +115,21 @@ private:
 	TSharedPtr<SListView<FPlasticSourceControlLockRef>> LocksListView;
 	TSharedPtr<TTextFilter<const FPlasticSourceControlLock&>> SearchTextFilter;
 
-	TArray<FPlasticSourceControlLockRef> SourceControlLocks; // Full list from source (filtered by date)
-	TArray<FPlasticSourceControlLockRef> LockRows; // Filtered list to display based on the search text filter
+	FPlasticSourceControlLocksIndexPtr LocksIndex; // Index of the full list, to apply only the changes of the next one
+	TArray<FPlasticSourceControlLockRef> SourceControlLocks; // Full list from source, kept in the sort order of the view
+	TArray<FPlasticSourceControlLockRef> LockRows; // Filtered list to display based on the search text filter, in the same order
+	FString RowsFilterText; // Search text the rows were filtered with, to only narrow them down when the text gets extended
+	bool bLocksSortPending = false; // The full list has to be sorted again before being filtered
+
+	/** Rows being sorted and filtered on a background thread for large lists of locks, applied by Tick() */
+	TFuture<TSharedPtr<FLockRowsUpdate, ESPMode::ThreadSafe>> PendingRowsUpdate;
+
+	/** Texts of the summary panel, formatted once per list of locks from the summary maintained by its index */
+	FText SummaryTitleText;
+	FText SummaryOwnersText;
+	FText SummaryBranchesText;
+	FText SummaryFoldersText;
+	FText SummaryAgesText;
 
 	/** Delegate handle for the HandleSourceControlStateChanged function callback */
 	FDelegateHandle SourceControlStateChangedDelegateHandle;